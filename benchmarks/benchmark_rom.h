@@ -0,0 +1,51 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARK_ROM_H
+#define BENCHMARK_ROM_H
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "polarGB/types.h"
+
+
+/**
+ * Writes a 32 KiB ROM without a memory bank controller to the temporary directory. The program
+ * is placed at the entry point 0x100. Returns the path of the ROM file.
+ */
+inline std::string writeBenchmarkRom(const std::string& name, const std::vector<u8>& program)
+{
+    std::vector<u8> rom(0x8000, 0x00);
+    std::copy(program.begin(), program.end(), rom.begin() + 0x100);
+
+    /* Header checksum over the title and cartridge info. */
+    u8 checksum = 0;
+    for(u16 addr = 0x134; addr <= 0x14c; addr++)
+        checksum = checksum - rom[addr] - 1;
+    rom[0x14d] = checksum;
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / (name + ".gb");
+    std::ofstream f(path, std::ios::out | std::ios::binary);
+    f.write((const char *)rom.data(), rom.size());
+
+    return path.string();
+}
+
+#endif /* BENCHMARK_ROM_H */
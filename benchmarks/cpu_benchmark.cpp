@@ -0,0 +1,105 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include <fmt/format.h>
+#include "polarGB/cpu.h"
+#include "polarGB/mmu.h"
+#include "benchmark_rom.h"
+
+
+const u64 BENCHMARK_CYCLES = 50000000;
+
+
+/**
+ * Writes a ROM that executes a tight loop of 8-bit ALU and register load instructions.
+ */
+std::string writeAluLoopRom()
+{
+    const std::vector<u8> program = {
+        0x06, 0x13,         /* 0x100: LD B, 0x13 */
+        0x0e, 0x37,         /*        LD C, 0x37 */
+        0x80,               /* loop:  ADD A, B */
+        0x89,               /*        ADC A, C */
+        0x92,               /*        SUB D */
+        0xab,               /*        XOR E */
+        0xa4,               /*        AND H */
+        0xb5,               /*        OR L */
+        0x04,               /*        INC B */
+        0x0d,               /*        DEC C */
+        0xb8,               /*        CP B */
+        0x57,               /*        LD D, A */
+        0x58,               /*        LD E, B */
+        0x61,               /*        LD H, C */
+        0x6f,               /*        LD L, A */
+        0x13,               /*        INC DE */
+        0x9b,               /*        SBC A, E */
+        0x2c,               /*        INC L */
+        0x18, 0xee          /*        JR loop */
+    };
+
+    return writeBenchmarkRom("polargb_cpu_benchmark", program);
+}
+
+
+/**
+ * Runs the CPU for a fixed amount of cycles and returns the elapsed time in seconds.
+ */
+double runBenchmark(const std::string& romPath, bool specialisedHandlers)
+{
+    auto interruptController = std::make_shared<InterruptController>();
+    auto graphicsController = std::make_shared<GraphicsController>(interruptController, true);
+    auto joypad = std::make_shared<Joypad>(interruptController);
+    auto timer = std::make_shared<Timer>(interruptController);
+    auto mmu = std::make_shared<Mmu>(graphicsController, interruptController, timer, joypad);
+    mmu->loadRom(romPath);
+
+    auto cpu = std::make_shared<Cpu>(mmu, interruptController);
+    cpu->setSpecialisedHandlers(specialisedHandlers);
+
+    u64 cycles = 0;
+    auto start = std::chrono::steady_clock::now();
+    while(cycles < BENCHMARK_CYCLES)
+        cycles += cpu->runBlock();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    cpu->shutDown();
+    mmu->shutDown();
+    graphicsController->shutDown();
+
+    return elapsed.count();
+}
+
+
+int main()
+{
+    std::string romPath = writeAluLoopRom();
+
+    double generic = runBenchmark(romPath, false);
+    double specialised = runBenchmark(romPath, true);
+
+    fmt::print("\nALU loop, {} cycles\n", BENCHMARK_CYCLES);
+    fmt::print("Generic handlers:     {:.3f} s ({:.1f} million cycles per second)\n", generic, BENCHMARK_CYCLES / generic / 1e6);
+    fmt::print("Specialised handlers: {:.3f} s ({:.1f} million cycles per second)\n", specialised, BENCHMARK_CYCLES / specialised / 1e6);
+    fmt::print("Speedup:              {:.2f}x\n", generic / specialised);
+
+    std::remove(romPath.c_str());
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <fmt/format.h>
+#include "polarGB/graphics_controller.h"
+#include "polarGB/interrupt_controller.h"
+
+
+const int BENCHMARK_FRAMES = 2000;
+const int CYCLES_PER_FRAME = 17556;
+
+
+/**
+ * Renders frames of random tiles and objects with the window covering the lower half of the
+ * screen and returns the time per frame in seconds. Frame skip leaves out the rendering of the
+ * given number of frames after every rendered frame.
+ */
+double runBenchmark(u32 frameSkip)
+{
+    auto interruptController = std::make_shared<InterruptController>();
+    GraphicsController graphicsController(interruptController, true);
+    graphicsController.setFrameSkip(frameSkip);
+
+    std::mt19937 random(1234);
+    for(u16 addr = 0; addr < 0x2000; addr++)
+        graphicsController.vramWrite(addr, random());
+    for(u16 addr = 0; addr < 0xa0; addr++)
+        graphicsController.oamWrite(addr, random());
+
+    graphicsController.displayRegisterWrite(RegLCDC, 0xf3);
+    graphicsController.displayRegisterWrite(RegSCX, 3);
+    graphicsController.displayRegisterWrite(RegWY, 72);
+    graphicsController.displayRegisterWrite(RegWX, 7);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < BENCHMARK_FRAMES; frame++)
+    {
+        for(int cycles = 0; cycles < CYCLES_PER_FRAME; cycles += 4)
+            graphicsController.update(4);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    graphicsController.shutDown();
+    return elapsed.count() / BENCHMARK_FRAMES;
+}
+
+
+int main()
+{
+    fmt::print("\nGraphics controller, {} frames\n", BENCHMARK_FRAMES);
+    for(u32 frameSkip : {0, 3})
+    {
+        double frameTime = runBenchmark(frameSkip);
+        fmt::print("Frame skip {}: {:.1f} us per frame ({:.0f} frames per second)\n", frameSkip,
+            frameTime * 1e6, 1.0 / frameTime);
+    }
+
+    return 0;
+}
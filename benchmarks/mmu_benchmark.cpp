@@ -0,0 +1,126 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include <fmt/format.h>
+#include "polarGB/mmu.h"
+#include "benchmark_rom.h"
+
+
+const unsigned int BENCHMARK_ACCESSES = 50000000;
+
+
+/**
+ * Runs an access pattern over a list of addresses and returns the elapsed time in seconds. The
+ * checksum keeps the compiler from removing the reads.
+ */
+template<typename Access>
+double measure(const std::vector<u16>& addresses, Access access)
+{
+    u64 checksum = 0;
+    size_t index = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(unsigned int i = 0; i < BENCHMARK_ACCESSES; i++)
+    {
+        checksum += access(addresses[index]);
+        if(++index == addresses.size())
+            index = 0;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if(checksum == 1)
+        fmt::print("");
+
+    return elapsed.count();
+}
+
+
+std::vector<u16> sequentialAddresses(u16 start, u16 end)
+{
+    std::vector<u16> addresses;
+    for(unsigned int addr = start; addr <= end; addr++)
+        addresses.push_back(addr);
+    return addresses;
+}
+
+
+std::vector<u16> randomAddresses(const std::vector<std::pair<u16, u16>>& ranges)
+{
+    std::mt19937 generator(1234);
+    std::vector<u16> addresses;
+    for(unsigned int i = 0; i < 0x10000; i++)
+    {
+        const std::pair<u16, u16>& range = ranges[generator() % ranges.size()];
+        addresses.push_back(range.first + generator() % (range.second - range.first + 1));
+    }
+    return addresses;
+}
+
+
+void report(const std::string& name, double seconds)
+{
+    fmt::print("{:<32} {:.3f} s ({:.1f} million accesses per second)\n", name, seconds,
+        BENCHMARK_ACCESSES / seconds / 1e6);
+}
+
+
+int main()
+{
+    std::string romPath = writeBenchmarkRom("polargb_mmu_benchmark", {0x76});
+
+    auto interruptController = std::make_shared<InterruptController>();
+    auto graphicsController = std::make_shared<GraphicsController>(interruptController, true);
+    auto joypad = std::make_shared<Joypad>(interruptController);
+    auto timer = std::make_shared<Timer>(interruptController);
+    auto mmu = std::make_shared<Mmu>(graphicsController, interruptController, timer, joypad);
+    mmu->loadRom(romPath);
+
+    std::vector<u16> romSequential = sequentialAddresses(0x0000, ROM_END_ADDR);
+    std::vector<u16> wramSequential = sequentialAddresses(WRAM_START_ADDR, WRAM_END_ADDR);
+    std::vector<u16> hramSequential = sequentialAddresses(HRAM_START_ADDR, HRAM_END_ADDR);
+    std::vector<u16> plainRandom = randomAddresses({{0x0000, ROM_END_ADDR}, {VRAM_START_ADDR, VRAM_END_ADDR},
+        {ERAM_START_ADDR, ERAM_END_ADDR}, {WRAM_START_ADDR, WRAM_END_ADDR}, {HRAM_START_ADDR, HRAM_END_ADDR}});
+    std::vector<u16> wordRandom = randomAddresses({{0x0000, ROM_END_ADDR - 1}, {VRAM_START_ADDR, VRAM_END_ADDR - 1},
+        {ERAM_START_ADDR, ERAM_END_ADDR - 1}, {WRAM_START_ADDR, WRAM_END_ADDR - 1}, {HRAM_START_ADDR, HRAM_END_ADDR - 1}});
+    std::vector<u16> ramRandom = randomAddresses({{ERAM_START_ADDR, ERAM_END_ADDR},
+        {WRAM_START_ADDR, WRAM_END_ADDR}, {HRAM_START_ADDR, HRAM_END_ADDR}});
+
+    auto read = [&mmu](u16 addr) { return mmu->read(addr); };
+    auto write = [&mmu](u16 addr) { mmu->write(addr, addr & 0xff); return 0; };
+    auto read16 = [&mmu](u16 addr) { return mmu->read2Bytes(addr); };
+    auto write16 = [&mmu](u16 addr) { mmu->write2Bytes(addr, addr); return 0; };
+
+    fmt::print("\n{} accesses per pattern\n", BENCHMARK_ACCESSES);
+    report("Sequential ROM reads", measure(romSequential, read));
+    report("Sequential WRAM reads", measure(wramSequential, read));
+    report("Sequential WRAM writes", measure(wramSequential, write));
+    report("Sequential HRAM reads", measure(hramSequential, read));
+    report("Random reads", measure(plainRandom, read));
+    report("Random RAM writes", measure(ramRandom, write));
+    report("Sequential ROM 16-bit reads", measure(sequentialAddresses(0x0000, ROM_END_ADDR - 1), read16));
+    report("Random 16-bit reads", measure(wordRandom, read16));
+    report("Sequential WRAM 16-bit writes", measure(sequentialAddresses(WRAM_START_ADDR, WRAM_END_ADDR - 1), write16));
+
+    mmu->shutDown();
+    graphicsController->shutDown();
+    std::remove(romPath.c_str());
+    return 0;
+}
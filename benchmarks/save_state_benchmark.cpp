@@ -0,0 +1,93 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include <fmt/format.h>
+#include "polarGB/emulator.h"
+#include "polarGB/rewind_buffer.h"
+#include "benchmark_rom.h"
+
+
+const int BENCHMARK_ITERATIONS = 10000;
+
+
+int main()
+{
+    const std::vector<u8> program = {
+        0x21, 0x00, 0xc0,   /* 0x100: LD HL, 0xc000 */
+        0x34,               /* loop:  INC (HL) */
+        0x18, 0xfd          /*        JR loop */
+    };
+    std::string romPath = writeBenchmarkRom("polargb_save_state_benchmark", program);
+
+    EmulatorOptions options;
+    options.headless = true;
+    Emulator emulator(options);
+    emulator.loadCartridge(romPath);
+    emulator.runFrames(10);
+
+    std::vector<u8> state;
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < BENCHMARK_ITERATIONS; i++)
+        state = emulator.saveState();
+    std::chrono::duration<double> saveTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < BENCHMARK_ITERATIONS; i++)
+        emulator.loadState(state);
+    std::chrono::duration<double> loadTime = std::chrono::steady_clock::now() - start;
+
+    /* A fork followed by one frame, which copies the pages that the frame writes. */
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < BENCHMARK_ITERATIONS; i++)
+    {
+        std::unique_ptr<Emulator> child = emulator.fork();
+        child->runFrames(1);
+    }
+    std::chrono::duration<double> forkTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < BENCHMARK_ITERATIONS; i++)
+        emulator.runFrames(1);
+    std::chrono::duration<double> frameTime = std::chrono::steady_clock::now() - start;
+
+    /* Rewind snapshots of consecutive frames, the cost that is added to every snapshot frame. */
+    RewindBuffer rewindBuffer(64 << 20);
+    std::chrono::duration<double> rewindTime(0);
+    for(int i = 0; i < BENCHMARK_ITERATIONS / 10; i++)
+    {
+        emulator.runFrames(1);
+        start = std::chrono::steady_clock::now();
+        rewindBuffer.record(emulator.saveState());
+        rewindTime += std::chrono::steady_clock::now() - start;
+    }
+
+    fmt::print("\nSave state of {} bytes, {} iterations\n", state.size(), BENCHMARK_ITERATIONS);
+    fmt::print("Save: {:.1f} us\n", saveTime.count() / BENCHMARK_ITERATIONS * 1e6);
+    fmt::print("Load: {:.1f} us\n", loadTime.count() / BENCHMARK_ITERATIONS * 1e6);
+    fmt::print("Fork and run a frame: {:.1f} us, a frame alone: {:.1f} us\n",
+        forkTime.count() / BENCHMARK_ITERATIONS * 1e6, frameTime.count() / BENCHMARK_ITERATIONS * 1e6);
+    fmt::print("Rewind snapshot: {:.1f} us, {} snapshots in {} bytes\n",
+        rewindTime.count() / (BENCHMARK_ITERATIONS / 10) * 1e6, rewindBuffer.getSnapshotCount(),
+        rewindBuffer.getMemoryUsage());
+
+    std::remove(romPath.c_str());
+    return 0;
+}
@@ -18,7 +18,7 @@
 #ifndef CARTRIDGE_H
 #define CARTRIDGE_H
 
-#include <fstream>
+#include <memory>
 #include <string>
 #include "types.h"
 #include "mbc.h"
@@ -27,14 +27,26 @@ class Cartridge
 {
 public:
     Cartridge();
+    Cartridge(const Cartridge& other);
     ~Cartridge();
 
+    Cartridge& operator=(const Cartridge&) = delete;
+
     void load(std::string fileName); /* Can throw a runtime_error. */
     void clear();
     void printInfo();
 
     u8 read(u16 address);
     void write(u16 address, u8 data);
+    int getRomBank(u16 address) const;
+    const u8* getRomBankData(u16 address) const;
+    const u8* getRamPage(u16 address) const;
+    u8* getWritableRamPage(u16 address);
+    bool hasRam() const;
+
+    /* Save states. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state); /* Can throw a runtime_error. */
 
 private:
     std::string fileName;
@@ -50,10 +62,9 @@ private:
     int ramSize;
     int destinationCode;
 
-    unsigned int getFileSize(std::ifstream *f);
-    void processCartridgeHeader(std::ifstream *f);
-    bool checksum(u8* cartridgeHeader);
-    void initializeMBC(std::ifstream *f);
+    void processCartridgeHeader(const u8* buffer);
+    bool checksum(const u8* cartridgeHeader);
+    void initializeMBC(std::shared_ptr<const RomImage> romImage);
 };
 
 #endif /* CARTRIDGE_H */
@@ -0,0 +1,83 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef COW_MEMORY_H
+#define COW_MEMORY_H
+
+#include <array>
+#include <cassert>
+#include <memory>
+#include <vector>
+#include "types.h"
+#include "save_state.h"
+
+
+const size_t COW_PAGE_SIZE = 0x100;
+
+
+/**
+ * Memory that is split in pages of 256 bytes, the page size of the Mmu page table. Copying the
+ * memory shares the pages, a shared page is copied when it is written to. This makes forking an
+ * emulator cheap, only the pages that are written after the fork are copied.
+ */
+class CowMemory
+{
+public:
+    CowMemory();
+    CowMemory(size_t size);
+
+    size_t size() const { return this->pages.size() * COW_PAGE_SIZE; }
+    void clear();
+
+    u8 read(size_t address) const;
+    void write(size_t address, u8 data);
+
+    /* Direct access to a page, the pointer stays valid until the page is copied on a write. */
+    const u8* getPage(size_t address) const;
+    u8* getWritablePage(size_t address);
+    bool isPageShared(size_t address) const;
+
+    /* Save states. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state);
+
+private:
+    typedef std::array<u8, COW_PAGE_SIZE> page_t;
+    std::vector<std::shared_ptr<page_t>> pages;
+};
+
+
+inline u8 CowMemory::read(size_t address) const
+{
+    assert(address < this->size());
+    return (*this->pages[address / COW_PAGE_SIZE])[address % COW_PAGE_SIZE];
+}
+
+
+inline void CowMemory::write(size_t address, u8 data)
+{
+    getWritablePage(address)[address % COW_PAGE_SIZE] = data;
+}
+
+
+inline const u8* CowMemory::getPage(size_t address) const
+{
+    assert(address < this->size());
+    return this->pages[address / COW_PAGE_SIZE]->data();
+}
+
+#endif /* COW_MEMORY_H */
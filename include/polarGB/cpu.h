@@ -18,13 +18,23 @@
 #ifndef CPU_H
 #define CPU_H
 
+#include <array>
+#include <bitset>
 #include <memory>
+#include <utility>
+#include <vector>
 #include "types.h"
+#include "save_state.h"
 #include "register.h"
 #include "mmu.h"
 #include "interrupt_controller.h"
 
 
+/* Maximum number of instructions in a basic block. Keeps the cycle count of a block within a u8
+ * and bounds the delay before pending interrupts are serviced. */
+const u8 MAX_BLOCK_LENGTH = 16;
+
+
 enum ConditionFlag
 {
     COND_NONE = 0,
@@ -43,7 +53,17 @@ enum OperandType
     OP_IMM,
     OP_IMM_PTR,
     OP_REG,
-    OP_MEM
+    OP_MEM,
+    OP_HIGH_MEM     /* Memory location 0xff00 + 8 bit register, used by LD (C), A and LD A, (C). */
+};
+
+
+enum ImmediateType
+{
+    IMM_NONE = 0,
+    IMM_8,          /* 8 bit immediate value. */
+    IMM_16,         /* 16 bit immediate value. */
+    IMM_HIGH_8      /* 8 bit immediate address offset from 0xff00. */
 };
 
 
@@ -56,6 +76,16 @@ typedef struct Operand
 } operand_t;
 
 
+typedef struct DecodeCacheStats
+{
+    u64 hits;
+    u64 misses;
+    u64 invalidations;  /* Number of RAM pages that were invalidated due to memory writes. */
+    u64 blocksBuilt;
+    u64 blocksExecuted;
+} decodeCacheStats_t;
+
+
 enum CpuState
 {
     off,
@@ -73,7 +103,7 @@ public:
         u16 memoryLocation;                             /* Location of the instruction */
         u8 opcode;                                      /* Opcode on the memory location */
         u8 instructionLength;                           /* Length of the instruction */
-        char mnemonic[16];                              /* Mnemonic of the instruction, used for debugging */
+        const char* mnemonic;                           /* Mnemonic of the instruction, used for debugging */
         operand_t operandSrc;                           /* Source operand of the instruction */
         operand_t operandDst;                           /* Destination operand of the instruction */
         u8 cycleCost;                                   /* Cost of the instruction in clock cycles */
@@ -81,29 +111,83 @@ public:
         void (Cpu::*executionFunction)(Instruction *);  /* Funtion that can execute this instruction. */
     } instruction_t;
 
+    typedef void (Cpu::*handler_t)(Instruction *);
+
+    /* Immutable description of an opcode. Decoding copies it into an instruction. */
+    typedef struct Opcode
+    {
+        const char* mnemonic;
+        u8 instructionLength;
+        u8 cycleCost;
+        u8 immediateType;                               /* Immediate value following the opcode */
+        operand_t operandSrc;
+        operand_t operandDst;
+        u8 extraInfo;
+        void (Cpu::*executionFunction)(Instruction *);
+    } opcode_t;
+
     Cpu(std::shared_ptr<Mmu> m, std::shared_ptr<InterruptController> ic);
+    Cpu(const Cpu& other, std::shared_ptr<Mmu> m, std::shared_ptr<InterruptController> ic);
     ~Cpu();
 
     void shutDown();
 
     u8 step();
+    u8 runBlock();
     CpuState getState() const;
+    u16 readRegister(regID_t id);
+    decodeCacheStats_t getDecodeCacheStats() const;
+
+    /* Use the handlers that are specialised on the operands of an opcode, enabled by default. */
+    void setSpecialisedHandlers(bool enable);
+    bool getSpecialisedHandlers() const;
+
+    /* Save states. */
+    void saveState(StateWriter& state);
+    void loadState(StateReader& state);
 
 private:
+    /* Decoded instructions of a 256 byte memory page. */
+    typedef struct DecodeCachePage
+    {
+        u32 version;                                    /* ROM page or RAM page version */
+        std::bitset<256> valid;
+        std::array<u8, 256> blockLengths;               /* Instructions in the block at an offset */
+        std::array<instruction_t, 256> instructions;
+    } decodeCachePage_t;
+
     Register reg;
     std::shared_ptr<Mmu> mmu;
     std::shared_ptr<InterruptController> interruptController;
-    instruction_t* currentInstruction;
     CpuState state;
+    u8 instructionCycles;   /* Cycle cost of the executing instruction, lowered by branches not taken. */
+    bool specialisedHandlers;
+
+    /* Decoded instruction cache. ROM pages are cached per ROM bank and never change, RAM pages are
+     * invalidated when the memory page has been written to. */
+    std::vector<std::unique_ptr<decodeCachePage_t>> romDecodeCache;
+    std::array<std::unique_ptr<decodeCachePage_t>, 128> ramDecodeCache;
+    decodeCacheStats_t decodeCacheStats;
+    void clearDecodeCache();
 
     /* Interrupt handling. */
     void checkInterrupts();
     void setupInterruptExecution(u8 interruptSignal);
 
     /* Instruction decoding.  */
+    static const opcode_t opcodeTable[256];
+    static const opcode_t prefixedOpcodeTable[256];
+    static const std::array<handler_t, 256> specialisedOpcodeHandlers;
+    template<u8 opcode> static constexpr handler_t selectSpecialisedHandler();
+    template<std::size_t... opcodes>
+    static constexpr std::array<handler_t, 256> makeSpecialisedHandlers(std::index_sequence<opcodes...>);
     instruction_t* fetchDecode();
+    decodeCachePage_t* getDecodeCachePage(u16 address);
+    instruction_t* getCachedInstruction(decodeCachePage_t* page, u16 address);
+    u32 getPageKey(u16 address) const;
+    u8 buildBlock(decodeCachePage_t* page, u16 address);
+    static bool endsBlock(const instruction_t* instr);
     void decodeOpcode(instruction_t *instr, u8 opcode);
-    void decodePrefixedOpcode(instruction_t *instr);
     void printInstructionInfo(instruction_t *instr);
 
     /* Instruction helper functions. */
@@ -112,6 +196,20 @@ private:
     void storeOperand8bits(operand_t* instr, u8 value);
     void storeOperand16bits(operand_t* instr, u16 value);
 
+    /* Operand access resolved at compile time. The register is the memory pointer for memory
+     * operands. */
+    template<u8 type, regID_t id> u8 loadOperand8(const operand_t* operand);
+    template<u8 type, regID_t id> void storeOperand8(const operand_t* operand, u8 value);
+
+    /* 8-bit arithmetic shared by the generic and the specialised handlers, these set the flags. */
+    u8 aluAdd(u8 a, u8 b, bool carry);
+    u8 aluSub(u8 a, u8 b, bool carry);
+    u8 aluAnd(u8 a, u8 b);
+    u8 aluXor(u8 a, u8 b);
+    u8 aluOr(u8 a, u8 b);
+    u8 aluInc(u8 value);
+    u8 aluDec(u8 value);
+
     /**
      * Instruction functions
      */
@@ -180,6 +278,22 @@ private:
     void executePUSH(instruction_t* instr);
     void _executePUSH(u16 value);   /* Convenient function for the push instr and starting interrupts. */
     void executePOP(instruction_t* instr);
+    u16 _executePOP();              /* Convenient function for the pop instr and returning from calls. */
+
+    /* Handlers specialised on the operands of an opcode, see opcodes.cpp. */
+    template<u8 srcType, regID_t src, u8 dstType, regID_t dst> void specialisedLD8(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedADD8(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedADC(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedSUB(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedSBC(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedAND(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedXOR(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedOR(instruction_t* instr);
+    template<u8 srcType, regID_t src> void specialisedCP(instruction_t* instr);
+    template<u8 dstType, regID_t dst> void specialisedINC8(instruction_t* instr);
+    template<u8 dstType, regID_t dst> void specialisedDEC8(instruction_t* instr);
+    template<regID_t dst> void specialisedINC16(instruction_t* instr);
+    template<regID_t dst> void specialisedDEC16(instruction_t* instr);
 };
 
 #endif /* CPU_H */
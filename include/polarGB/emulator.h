@@ -18,9 +18,15 @@
 #ifndef EMULATOR_H
 #define EMULATOR_H
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 #include "types.h"
+#include "save_state.h"
+#include "rewind_buffer.h"
 #include "interrupt_controller.h"
 #include "joypad.h"
 #include "timer.h"
@@ -35,17 +41,66 @@ const double FPS = CPU_FREQUENCY / (double)INSTRUCTIONS_PER_FRAME;
 const double FRAME_TIME = 1.0 / FPS;
 
 
+struct EmulatorOptions
+{
+    bool headless = false;  /* No window, input or frame pacing. Frames are only rendered in memory. */
+    u64 frameLimit = 0;     /* Stop after this many frames, 0 runs until the user quits. */
+    double speed = 1.0;     /* Speed multiplier, 0 runs as fast as possible. Ignored when headless. */
+    size_t rewindMemory = 0;    /* Bytes for rewind snapshots, 0 disables rewinding. */
+    u32 rewindInterval = 4;     /* Frames between rewind snapshots. */
+    u32 frameSkip = 0;  /* Frames not rendered after every rendered frame, their timing is kept. */
+    bool printStats = false;    /* Print the cache and display counters when start returns. */
+};
+
+
 class Emulator
 {
 public:
     Emulator();
+    Emulator(const EmulatorOptions& options);
     ~Emulator();
 
     int start(std::string cartridgePath);
+    void setSpeed(double speed);
+    double getSpeed() const;
+    void setFrameSkip(u32 frames);
+
+    /* Batch execution without pacing, a cartridge has to be loaded first. The run functions return
+     * the number of cycles that were executed. */
+    void loadCartridge(std::string cartridgePath);
+    u64 runFrames(u64 frames);
+    u64 runCycles(u64 cycles);
+    bool runUntil(std::function<bool(Emulator&)> predicate, u64 maxCycles = 0);
+
+    /* State of the emulated Game Boy. */
+    u16 readRegister(regID_t id);
+    u8 readMemory(u16 address);
+    CpuState getCpuState() const;
+    const std::vector<u8>& getSerialOutput() const;
+    const u8* getFramebuffer() const;
+    u64 getFramesCompleted() const;
+    u64 getCyclesCompleted() const;
+
+    /* Snapshot of every subsystem. Loading requires the same cartridge to be loaded. */
+    std::vector<u8> saveState();
+    void loadState(const std::vector<u8>& state); /* Can throw a runtime_error. */
+
+    /* Steps back to the last rewind snapshot, returns false if there is none. Snapshots are taken
+     * at frame boundaries by the frame based run functions. */
+    bool rewind();
+    const RewindBuffer* getRewindBuffer() const;
+
+    /* Headless copy of the emulator that shares the memory pages with this emulator until either
+     * of them writes to a page. */
+    std::unique_ptr<Emulator> fork();
 
 private:
-    bool isRunning;
-    u64 cyclesCompleted;
+    EmulatorOptions options;
+    std::atomic<bool> isRunning;    /* Cleared by either thread of a windowed run to stop it */
+    u64 cyclesCompleted;    /* Cycles into the current frame */
+    u64 framesCompleted;
+    u64 totalCycles;
+    size_t lastStateSize;
 
     std::shared_ptr<InterruptController> interruptController;
     std::shared_ptr<Joypad> joypad;
@@ -53,11 +108,18 @@ private:
     std::shared_ptr<GraphicsController> graphicsController;
     std::shared_ptr<Mmu> mmu;
     std::shared_ptr<Cpu> cpu;
+    std::unique_ptr<RewindBuffer> rewindBuffer;
 
     void startUp();
     void shutDown();
+    void printStats() const;
     void run();
+    void runPaced();
+    void runHeadless();
+    void waitUntil(std::chrono::steady_clock::time_point deadline);
     void runFrame();
+    void recordRewindSnapshot();
+    void advance(u8 cpuCycles);
 };
 
 #endif /* EMULATOR_H */
@@ -0,0 +1,94 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMULATOR_POOL_H
+#define EMULATOR_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "types.h"
+#include "emulator.h"
+
+
+typedef struct EmulatorStats
+{
+    u64 frames;         /* Frames executed by the pool */
+    u64 cycles;         /* Cycles executed by the pool */
+    u64 slices;         /* Number of frame slices that were scheduled */
+    double runTime;     /* Seconds spent executing the slices */
+} emulatorStats_t;
+
+
+/**
+ * Runs many independent headless emulators on a pool of threads. Every instance runs a number of
+ * frames in slices of a few frames. Each thread owns a queue of slices and steals from the other
+ * queues when its own queue is empty.
+ */
+class EmulatorPool
+{
+public:
+    EmulatorPool(unsigned int threadCount = 0, u64 sliceFrames = 1); /* 0 threads uses every core. */
+    ~EmulatorPool();
+
+    size_t addInstance(const std::string& cartridgePath, u64 frames);
+    void run();
+
+    size_t getInstanceCount() const;
+    unsigned int getThreadCount() const;
+    Emulator& getInstance(size_t index);
+    emulatorStats_t getStats(size_t index) const;
+    u64 getSteals() const;
+
+private:
+    typedef struct Instance
+    {
+        std::unique_ptr<Emulator> emulator;
+        u64 framesRemaining;
+        emulatorStats_t stats;
+    } instance_t;
+
+    typedef struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<size_t> instances;
+    } workQueue_t;
+
+    unsigned int threadCount;
+    u64 sliceFrames;
+    std::vector<instance_t> instances;
+    std::vector<std::unique_ptr<workQueue_t>> queues;
+    std::atomic<size_t> unfinishedInstances;
+    std::atomic<u64> steals;
+
+    /* Workers without work sleep until a slice is queued or every instance is done. */
+    std::mutex idleMutex;
+    std::condition_variable workAvailable;
+    u64 workEpoch;  /* Incremented under idleMutex whenever workAvailable is notified */
+
+    void worker(unsigned int id);
+    void notifyWorkers(bool all);
+    bool popInstance(unsigned int id, size_t& index);
+    bool stealInstance(unsigned int id, size_t& index);
+    void runSlice(size_t index);
+};
+
+#endif /* EMULATOR_POOL_H */
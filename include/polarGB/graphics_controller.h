@@ -19,10 +19,14 @@
 #define GRAPHICS_CONTROLLER_H
 
 #include <array>
+#include <bitset>
+#include <chrono>
 #include <memory>
 #include <string>
-#include <list>
 #include "types.h"
+#include "save_state.h"
+#include "cow_memory.h"
+#include "scanline.h"
 #include "interrupt_controller.h"
 #include "graphics_display.h"
 
@@ -52,6 +56,13 @@ struct SpriteAttributes
     u8 flags;
 };
 
+/* Tiles in the tile data area 0x8000-0x97ff. */
+const u16 TILE_COUNT = 384;
+
+/* The hardware shows at most 10 objects on a scanline. */
+const u8 MAX_OBJECTS_PER_LINE = 10;
+
+
 bool compareSpriteAttributesByXCoordinate(SpriteAttributes first, SpriteAttributes second);
 
 
@@ -59,6 +70,7 @@ class GraphicsController
 {
 public:
     GraphicsController(std::shared_ptr<InterruptController> ic, bool noWindow);
+    GraphicsController(const GraphicsController& other, std::shared_ptr<InterruptController> ic);
     ~GraphicsController();
 
     /* Initialization and clean up. */
@@ -67,18 +79,41 @@ public:
     /* Video RAM read and write. */
     u8 vramRead(u16 address);
     void vramWrite(u16 address, u8 data);
+    const u8* getVramPage(u16 address) const;
+
+    /* Decoded tiles, a row holds the shades of its 8 pixels with the leftmost pixel in the lowest
+     * byte. Tiles that changed since clearDirtyTiles are marked dirty, for example for a tile
+     * viewer. */
+    u64 getTileRow(u16 tile, u8 row) const;
+    const std::bitset<TILE_COUNT>& getDirtyTiles() const;
+    void clearDirtyTiles();
     u8 oamRead(u16 address);
     void oamWrite(u16 address, u8 data);
     u8 displayRegisterRead(displayRegister_t reg);
     void displayRegisterWrite(displayRegister_t reg, u8 data);
 
     void update(u8 cycles);
+    const u8* getFramebuffer() const;
+    void setFramePresentation(bool enabled);
+    void setFrameSkip(u32 frames);
+    bool presentNextFrame(std::chrono::milliseconds timeout);
+    presentStats_t getPresentStats() const;
+
+    /* Save states. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state);
 
 private:
     /* Memory */
-    ram_t vram;
+    CowMemory vram;
     std::array<SpriteAttributes, 40> oam; /* 40 objects of size 32 bits. */
 
+    /* Tile data decoded from the 2 bit planes in VRAM, updated by vramWrite. Forks share it until
+     * one of them writes tile data. */
+    typedef std::array<u64, TILE_COUNT * 8> tileCache_t;
+    std::shared_ptr<tileCache_t> tileCache;
+    std::bitset<TILE_COUNT> dirtyTiles;
+
     /* Display registers */
     u8 LCDC;
     u8 STAT;
@@ -96,18 +131,36 @@ private:
     /* Member variables */
     u8 mode;
     u64 modeCycles;
-    std::list<SpriteAttributes> objectsOnCurrentScanline;
 
-    bool noWindow;  /* Mainly used for testing in order to not setup the window. */
+    /* Objects found by the OAM scan, sorted on their x coordinate which is also their drawing
+     * priority. */
+    std::array<SpriteAttributes, MAX_OBJECTS_PER_LINE> objectsOnCurrentScanline;
+    u8 objectCount;
+
+    /* Pixel data of the screen in ABGR8888 format when there is no window, otherwise the frames
+     * are rendered into the buffers of the display. A fork shares the framebuffer until it
+     * renders a scanline. */
+    typedef std::array<u8, SCREEN_WIDTH * SCREEN_HEIGHT * 4> framebuffer_t;
+    std::shared_ptr<framebuffer_t> framebuffer;
+
+    bool noWindow;  /* Headless, the frames are only rendered into the framebuffer. */
+    bool presentFrames; /* Cleared to skip presenting frames, for example in fast-forward. */
+    u32 frameSkip;          /* Frames skipped after every rendered frame */
+    u32 framesUntilRender;  /* Frames left to skip before the next rendered frame */
+    bool skipFrame;         /* The current frame is not rendered */
     GraphicsDisplay* display;
     std::shared_ptr<InterruptController> interruptController;
 
+    bool updateMode();
     void updateMatchFlag();
 
     void setCurrentMode(u8 newMode);
     void processScanline();
-    void processBackgroundPixel(u8 x);
-    void processObjectPixel(u8 x);
+    u8* getWritableFramebuffer();
+    void processBackgroundLine(std::array<u8, SCREEN_WIDTH>& line);
+    u64 fetchTileRow(u16 tileMapAddr, u8 tileX, u8 y);
+    void decodeTileRow(u16 address);
+    void processObjectLine(std::array<u8, SCREEN_WIDTH>& line);
 
     /* MODE 2: OAM Scan */
     void searchForObjectsOnCurrentScanline();
@@ -115,10 +168,10 @@ private:
     /* MODE 3: Drawing pixels */
     /*
     processScanline
-        processBackgroundPixel
-        processWindowPixel
-        processObjectPixel
-
+        processBackgroundLine
+            fetchTileRow
+        processObjectLine
+        expandScanline
     */
 };
 
@@ -19,14 +19,38 @@
 #define GRAPHICS_DISPLAY_H
 
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <SDL2/SDL.h>
 #include "types.h"
+#include "triple_buffer.h"
 
 
 const int SCREEN_WIDTH = 160;
 const int SCREEN_HEIGHT = 144;
 
+
+typedef struct PresentStats
+{
+    u64 framesPresented;
+    u64 framesDropped;      /* Frames replaced by a newer frame before the main thread took them */
+    double averageLatency;  /* Seconds from handing a frame over until it was presented */
+    double maxLatency;
+} presentStats_t;
+
+
+/**
+ * Window that presents the frames of the emulator. SDL only allows its window, renderer and
+ * events on the main thread, so the emulation runs on a thread of its own and hands its frames to
+ * the main thread through a triple buffer. The emulation never waits for the texture upload, the
+ * present or vsync.
+ *
+ * The graphics controller renders straight into the buffers of the triple buffer, the only copy
+ * of a frame is its upload into the texture.
+ */
 class GraphicsDisplay
 {
 
@@ -37,9 +61,15 @@ public:
     int startUp();
     void shutDown();
 
-    void updatePixel(u8 x, u8 y, u8 r, u8 g, u8 b, u8 a);
+    /* Emulation thread. */
+    u8* getWritableFrame();
+    const u8* getFrame() const;
     void drawFrame();
 
+    /* Main thread. */
+    bool presentNextFrame(std::chrono::milliseconds timeout);
+    presentStats_t getPresentStats() const;
+
 private:
     std::string windowName;
     int width;
@@ -47,13 +77,26 @@ private:
     SDL_Window* window;
     SDL_Renderer* renderer;
     SDL_Texture* texture;
-    u8* pixels;
     void* texturePixels;
     int pitch;
 
+    /* Frame handover */
+    TripleBuffer frames;
+    u8* currentFrame;   /* Frame being rendered, or the last drawn frame until rendering continues */
+    std::mutex frameMutex;  /* Only used to sleep on frameReady, drawFrame never locks it */
+    std::condition_variable frameReady;
+
+    std::atomic<u64> framesPresented;
+    std::atomic<u64> totalLatency;  /* Nanoseconds */
+    std::atomic<u64> maxLatency;
+
+    bool createRenderer();
+    void destroyRenderer();
+    void presentFrame(const u8* pixels);
+
     bool lockTexture();
     void unlockTexture();
-    void copyPixelsToTexture();
+    void copyPixelsToTexture(const u8* pixels);
 };
 
 
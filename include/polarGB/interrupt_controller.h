@@ -20,6 +20,7 @@
 
 
 #include "types.h"
+#include "save_state.h"
 
 
 typedef enum InterruptSignal
@@ -60,6 +61,10 @@ public:
     void setIF(u8 value);
     void setIE(u8 value);
 
+    /* Save states. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state);
+
 private:
     /* Interrupt registers. */
     u8 IF; /* Address: 0xff0f*/
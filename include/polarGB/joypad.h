@@ -18,9 +18,11 @@
 #ifndef JOYPAD_H
 #define JOYPAD_H
 
+#include <atomic>
 #include <memory>
 #include <SDL2/SDL.h>
 #include "types.h"
+#include "save_state.h"
 #include "interrupt_controller.h"
 
 
@@ -28,27 +30,35 @@ class Joypad
 {
 public:
     Joypad(std::shared_ptr<InterruptController> interruptController);
+    Joypad(const Joypad& other, std::shared_ptr<InterruptController> interruptController);
     ~Joypad();
 
     u8 read();
     void write(u8 data);
     void processInput();
     bool getButtonQuit() const;
+    bool getButtonRewind() const;
+
+    /* Save states. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state);
 
 private:
     std::shared_ptr<InterruptController> interruptController;
     u8 P1;
 
-    /* Buttons pressed. */
-    bool buttonQuit;
-    bool buttonA;
-    bool buttonB;
-    bool buttonSelect;
-    bool buttonStart;
-    bool buttonRight;
-    bool buttonLeft;
-    bool buttonUp;
-    bool buttonDown;
+    /* Buttons pressed. The main thread processes the input while the emulation thread reads the
+     * buttons. */
+    std::atomic<bool> buttonQuit;
+    std::atomic<bool> buttonRewind;
+    std::atomic<bool> buttonA;
+    std::atomic<bool> buttonB;
+    std::atomic<bool> buttonSelect;
+    std::atomic<bool> buttonStart;
+    std::atomic<bool> buttonRight;
+    std::atomic<bool> buttonLeft;
+    std::atomic<bool> buttonUp;
+    std::atomic<bool> buttonDown;
 
     void processKeyDown(SDL_Keycode keysym);
     void processKeyUp(SDL_Keycode keysym);
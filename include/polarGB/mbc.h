@@ -18,35 +18,177 @@
 #ifndef MBC_H
 #define MBC_H
 
-#include <fstream>
+#include <array>
+#include <memory>
 #include <vector>
 #include "types.h"
+#include "save_state.h"
+#include "cow_memory.h"
+#include "rom_image.h"
 
+
+const u16 ROM_BANK_SIZE = 0x4000;
+const u16 RAM_BANK_SIZE = 0x2000;
+
+
+/**
+ * Memory bank controller base class. Cartridges without a controller use it directly through
+ * NoMBC. The ROM banks that are visible at 0x0000-0x3fff and 0x4000-0x7fff are kept as pointers
+ * into the shared ROM image, switching a bank only replaces a pointer. Copies of a controller share
+ * their RAM pages until one of them writes to a page.
+ */
 class MBC
 {
 public:
-    MBC(int romSizeInBytes, int ramSizeInBytes);
+    MBC(std::shared_ptr<const RomImage> romImage, int romSizeInBytes, int ramSizeInBytes);
     virtual ~MBC();
 
-    void loadROM(std::ifstream *f);
+    /* Copy of the controller that shares the ROM image and the RAM pages. */
+    virtual MBC* clone() const;
+
     void clear();
 
-    virtual u8 read(u16 address);
-    virtual void write(u16 address, u8 data);
+    u8 read(u16 address);
+    void write(u16 address, u8 data);
+
+    /* Memory map, used by the Mmu page table. */
+    int getRomBank(u16 address) const;
+    const u8* getRomBankData(u16 address) const;
+    const u8* getRamPage(u16 address) const;
+    u8* getWritableRamPage(u16 address);
+    bool hasRam() const;
+
+    /* Save states. */
+    virtual void saveState(StateWriter& state) const;
+    virtual void loadState(StateReader& state);
 
 protected:
     int romSize;
-    std::vector<u8> romMem;
+    std::shared_ptr<const RomImage> romImage;
 
     int ramSize;
-    std::vector<u8> ramMem;
+    CowMemory ramMem;
+
+    /* Currently mapped banks. */
+    std::array<int, 2> romBankNumbers;
+    std::array<const u8*, 2> romBanks;
+    size_t ramBankOffset;
+    bool ramEnabled;
+
+    void selectRomBanks(int lowBank, int highBank);
+    void selectRamBank(int bank);
+
+    /* Controller specific behaviour. */
+    virtual void writeRegister(u16 address, u8 data);
+    virtual u8 readRam(u16 address);
+    virtual void writeRam(u16 address, u8 data);
+    virtual bool isRamMemoryMapped() const;
 };
 
+
 class NoMBC : public MBC
 {
 public:
-    NoMBC(int romSizeInBytes, int ramSizeInBytes);
+    NoMBC(std::shared_ptr<const RomImage> romImage, int romSizeInBytes, int ramSizeInBytes);
     ~NoMBC();
+
+    MBC* clone() const override;
+};
+
+
+/**
+ * MBC1, up to 2 MiB ROM and 32 KiB RAM.
+ */
+class MBC1 : public MBC
+{
+public:
+    MBC1(std::shared_ptr<const RomImage> romImage, int romSizeInBytes, int ramSizeInBytes);
+    ~MBC1();
+
+    MBC* clone() const override;
+
+    void saveState(StateWriter& state) const override;
+    void loadState(StateReader& state) override;
+
+protected:
+    void writeRegister(u16 address, u8 data) override;
+
+private:
+    u8 romBankLow;      /* 5 bit ROM bank register */
+    u8 bankHigh;        /* 2 bit upper ROM bank or RAM bank register */
+    bool advancedMode;  /* Banking mode 1, the upper bits also apply to 0x0000-0x3fff and RAM. */
+
+    void updateBanks();
+};
+
+
+/**
+ * MBC2, up to 256 KiB ROM and 512 x 4 bits of built-in RAM.
+ */
+class MBC2 : public MBC
+{
+public:
+    MBC2(std::shared_ptr<const RomImage> romImage, int romSizeInBytes);
+    ~MBC2();
+
+    MBC* clone() const override;
+
+protected:
+    void writeRegister(u16 address, u8 data) override;
+    u8 readRam(u16 address) override;
+    void writeRam(u16 address, u8 data) override;
+    bool isRamMemoryMapped() const override;
+};
+
+
+/**
+ * MBC3, up to 2 MiB ROM, 32 KiB RAM and a real time clock. The clock registers can be written and
+ * latched, the clock itself does not advance which keeps emulation deterministic.
+ */
+class MBC3 : public MBC
+{
+public:
+    MBC3(std::shared_ptr<const RomImage> romImage, int romSizeInBytes, int ramSizeInBytes);
+    ~MBC3();
+
+    MBC* clone() const override;
+
+    void saveState(StateWriter& state) const override;
+    void loadState(StateReader& state) override;
+
+protected:
+    void writeRegister(u16 address, u8 data) override;
+    u8 readRam(u16 address) override;
+    void writeRam(u16 address, u8 data) override;
+    bool isRamMemoryMapped() const override;
+
+private:
+    u8 ramBankSelect;                   /* RAM bank 0x0-0x3 or clock register 0x8-0xc */
+    std::array<u8, 5> clockRegisters;   /* Seconds, minutes, hours, day low and day high */
+    std::array<u8, 5> latchedClockRegisters;
+    u8 latchValue;
+};
+
+
+/**
+ * MBC5, up to 8 MiB ROM and 128 KiB RAM.
+ */
+class MBC5 : public MBC
+{
+public:
+    MBC5(std::shared_ptr<const RomImage> romImage, int romSizeInBytes, int ramSizeInBytes);
+    ~MBC5();
+
+    MBC* clone() const override;
+
+    void saveState(StateWriter& state) const override;
+    void loadState(StateReader& state) override;
+
+protected:
+    void writeRegister(u16 address, u8 data) override;
+
+private:
+    u16 romBank;    /* 9 bit ROM bank register */
 };
 
 #endif /* MBC_H */
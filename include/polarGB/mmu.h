@@ -18,9 +18,13 @@
 #ifndef MEMORY_MANAGER_H
 #define MEMORY_MANAGER_H
 
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
 #include "types.h"
+#include "save_state.h"
+#include "cow_memory.h"
 #include "cartridge.h"
 #include "graphics_controller.h"
 #include "interrupt_controller.h"
@@ -104,6 +108,9 @@ class Mmu
 public:
     Mmu(std::shared_ptr<GraphicsController> gc, std::shared_ptr<InterruptController> ic,
         std::shared_ptr<Timer> timer, std::shared_ptr<Joypad> joypad);
+    Mmu(const Mmu& other, std::shared_ptr<GraphicsController> gc,
+        std::shared_ptr<InterruptController> ic, std::shared_ptr<Timer> timer,
+        std::shared_ptr<Joypad> joypad);
     ~Mmu();
 
     /* Small boot program for the mmu. */
@@ -113,6 +120,10 @@ public:
     u8 read(u16 addr);
     u16 read2Bytes(u16 addr);
 
+    /* Pointer to length bytes of plain memory at addr, nullptr if they cross a page or are not
+     * plain memory. The pointer is valid until the memory map changes. */
+    const u8* fetch(u16 addr, u8 length) const;
+
     /* Write data to memory. */
     void write(u16 addr, u8 data);
     void write2Bytes(u16 addr, u16 data);
@@ -120,12 +131,44 @@ public:
     /* Load a rom file into memory. */
     void loadRom(std::string fileName);
 
+    /* Index of the physical 256 byte ROM page that is mapped at a ROM address. */
+    u32 getRomPage(u16 addr) const
+    {
+        return (static_cast<u32>(romBanks[addr >> 14]) << 6) | ((addr & 0x3fff) >> 8);
+    }
+
+    /* Write counter of the 256 byte page containing the address. */
+    u32 getPageVersion(u16 addr) const
+    {
+        return pageVersions[addr >> 8];
+    }
+
+    /* Points the page table to the current RAM pages, required after the pages became shared. */
+    void updateMemoryMap();
+
+    /* Bytes that were sent over the serial port. */
+    const std::vector<u8>& getSerialOutput() const;
+    void clearSerialOutput();
+
+    /* Save states, including the cartridge. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state);
+
 private:
     Cartridge rom;    /* Game cartridge */
-    ram_t ERAM;       /* External RAM */
-    ram_t WRAM;       /* Working RAM */
+    u16 romBanks[2];  /* ROM banks mapped at 0x0000-0x3fff and 0x4000-0x7fff */
+    std::array<u32, 256> pageVersions;
+
+    /* Host memory of every 256 byte page. Pages without a pointer, such as I/O and OAM, writes to
+     * ROM and VRAM or writes to RAM pages that are shared with a fork, are handled by readSlow and
+     * writeSlow. */
+    std::array<const u8*, 256> readPages;
+    std::array<u8*, 256> writePages;
+    CowMemory ERAM;   /* External RAM */
+    CowMemory WRAM;   /* Working RAM */
     ram_t HardwareRegisters;
     ram_t HRAM;       /* High Ram / CPU working RAM */
+    std::vector<u8> serialOutput;
 
     std::shared_ptr<GraphicsController> graphicsController;
     std::shared_ptr<InterruptController> interruptController;
@@ -133,9 +176,83 @@ private:
     std::shared_ptr<Timer> timer;
 
     void initializeMemory();
+    void mapPages(u16 startAddr, u16 endAddr, const u8* readMem, u8* writeMem);
+    void mapRamPage(u16 addr);
+    void updateCartridgeBanks();
+    u8 readSlow(u16 addr);
+    void writeSlow(u16 addr, u8 data);
     void DMATransfer(u8 index);
+    void serialTransfer(u8 control);
     u8 readHardwareRegister(u16 addr);
     void writeHardwareRegister(u16 addr, u8 data);
 };
 
+inline u8 Mmu::read(u16 addr)
+{
+    const u8* page = this->readPages[addr >> 8];
+    if(page != nullptr)
+        return page[addr & 0xff];
+
+    return readSlow(addr);
+}
+
+
+/**
+ * Fetches 16 bits from memory. The first byte is the low byte and the second byte is the high
+ * byte. Both bytes are read at once when they lie in the same page.
+ */
+inline u16 Mmu::read2Bytes(u16 addr)
+{
+    const u8* page = this->readPages[addr >> 8];
+    u8 offset = addr & 0xff;
+    if(page != nullptr && offset != 0xff)
+        return page[offset] | (page[offset + 1] << 8);
+
+    return read(addr) | (read(addr + 1) << 8);
+}
+
+
+inline const u8* Mmu::fetch(u16 addr, u8 length) const
+{
+    const u8* page = this->readPages[addr >> 8];
+    if(page == nullptr || (addr & 0xff) + length > 0x100)
+        return nullptr;
+
+    return page + (addr & 0xff);
+}
+
+
+inline void Mmu::write(u16 addr, u8 data)
+{
+    /* Let the decode cache know that this page has changed. */
+    this->pageVersions[addr >> 8]++;
+
+    u8* page = this->writePages[addr >> 8];
+    if(page != nullptr)
+        page[addr & 0xff] = data;
+    else
+        writeSlow(addr, data);
+}
+
+
+/**
+ * Writes two bytes of data to memory, the low byte first.
+ */
+inline void Mmu::write2Bytes(u16 addr, u16 data)
+{
+    u8* page = this->writePages[addr >> 8];
+    u8 offset = addr & 0xff;
+    if(page != nullptr && offset != 0xff)
+    {
+        this->pageVersions[addr >> 8]++;
+        page[offset] = data & 0xff;
+        page[offset + 1] = data >> 8;
+        return;
+    }
+
+    this->write(addr, data & 0xff);
+    this->write(addr + 1, (data >> 8) & 0xff);
+}
+
+
 #endif /* MEMORY_MANAGER_H */
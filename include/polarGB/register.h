@@ -18,7 +18,9 @@
 #ifndef REGISTER_H
 #define REGISTER_H
 
+#include <cassert>
 #include "types.h"
+#include "save_state.h"
 
 
 /* Decleration of the standard Gameboy registers that can store 2 variables of 8 bits or one 16
@@ -67,13 +69,32 @@ typedef enum RegID
 } regID_t;
 
 
-struct RegPair
-{
-    u8 high;
-    u8 low;
+/* The 8 bit registers are views into the 16 bit register pairs. On a little-endian host the low
+ * register (F, C, E, L) is the first byte of a pair, big-endian hosts swap the byte index. */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+const u8 REGISTER_BYTE_SWAP = 1;
+#else
+const u8 REGISTER_BYTE_SWAP = 0;
+#endif
+
+/* Index of a register in the byte view (8 bit registers) or the word view (16 bit registers). */
+constexpr u8 REGISTER_INDEX[] = {
+    0,                                                          /* NONE */
+    1 ^ REGISTER_BYTE_SWAP, 0 ^ REGISTER_BYTE_SWAP,             /* A, F */
+    3 ^ REGISTER_BYTE_SWAP, 2 ^ REGISTER_BYTE_SWAP,             /* B, C */
+    5 ^ REGISTER_BYTE_SWAP, 4 ^ REGISTER_BYTE_SWAP,             /* D, E */
+    7 ^ REGISTER_BYTE_SWAP, 6 ^ REGISTER_BYTE_SWAP,             /* H, L */
+    0, 1, 2, 3, 4, 5                                            /* AF, BC, DE, HL, SP, PC */
 };
 
 
+/* Flag bits in register F. */
+const u8 FLAG_ZERO = 0x80;
+const u8 FLAG_SUB = 0x40;
+const u8 FLAG_HALF_CARRY = 0x20;
+const u8 FLAG_CARRY = 0x10;
+
+
 class Register
 {
 public:
@@ -83,6 +104,10 @@ public:
     u16 read(regID_t id);
     void write(regID_t id, u16 value);
 
+    /* Access to a register that is known at compile time. */
+    template<regID_t id> u16 get();
+    template<regID_t id> void set(u16 value);
+
     /* Functions for getting the flags from register F. */
     bool getFlagZero() const;
     bool getFlagSub() const;
@@ -94,27 +119,245 @@ public:
     void setFlagSub(bool val);
     void setFlagHalfCarry(bool val);
     void setFlagCarry(bool val);
+    void setFlags(bool zero, bool sub, bool halfCarry, bool carry);
+
+    /* Lazily evaluated flags of an 8 bit addition or subtraction, these return the result. */
+    u8 setFlagsAdd(u8 a, u8 b, bool carry);
+    u8 setFlagsSub(u8 a, u8 b, bool carry);
 
     void printRegister();
 
-private:
-    u8 readSingle(regID_t id);
-    u16 readDouble(regID_t id);
-    void writeSingle(regID_t id, u8 value);
-    void writeDouble(regID_t id, u16 value);
+    /* Save states. */
+    void saveState(StateWriter& state);
+    void loadState(StateReader& state);
 
-    /* Bit flag operations. */
-    bool getBitFromFlags(int position) const;
-    void setBitFromFlags(int position, bool val);
+private:
+    enum LazyFlags : u8
+    {
+        LAZY_NONE = 0,  /* Register F holds the flags. */
+        LAZY_ADD,
+        LAZY_SUB
+    };
 
     /* Register variables. */
-    RegPair AF;
-    RegPair BC;
-    RegPair DE;
-    RegPair HL;
-    u16 SP;
-    u16 PC;
+    union
+    {
+        u8 bytes[12];
+        u16 words[6];
+    } registers;
+
+    /* Operands of the last lazily evaluated operation, the flags are derived from these on
+     * demand and written to register F when it is read or partially updated. */
+    u8 lazyFlags;
+    u8 lazyA;
+    u8 lazyB;
+    u8 lazyCarry;
+    u8 lazyResult;
+
+    void materializeFlags();
 };
 
 
+/**
+ * Reads the content of a register.
+ */
+inline u16 Register::read(regID_t id)
+{
+    assert(id != RegID_NONE);
+
+    if(id == RegID_F || id == RegID_AF)
+        materializeFlags();
+
+    if(id < RegID_AF)
+        return registers.bytes[REGISTER_INDEX[id]];
+
+    return registers.words[REGISTER_INDEX[id]];
+}
+
+
+/**
+ * Writes a value to a register. Note there are restrictions. A 1 byte register can only store 1
+ * byte, not the full 2 byte (u16 type) value argument. The lower 4 bits of F are always zero.
+ */
+inline void Register::write(regID_t id, u16 value)
+{
+    assert(id != RegID_NONE);
+
+    if(id < RegID_AF)
+    {
+        assert(value < 0x100);
+        registers.bytes[REGISTER_INDEX[id]] = value;
+    }
+    else
+        registers.words[REGISTER_INDEX[id]] = value;
+
+    if(id == RegID_F || id == RegID_AF)
+    {
+        lazyFlags = LAZY_NONE;
+        registers.bytes[REGISTER_INDEX[RegID_F]] &= 0xf0;
+    }
+}
+
+
+/**
+ * Reads a register without dispatching on the register id at runtime.
+ */
+template<regID_t id>
+u16 Register::get()
+{
+    static_assert(id != RegID_NONE, "Invalid register");
+
+    if constexpr(id == RegID_F || id == RegID_AF)
+        materializeFlags();
+
+    if constexpr(id < RegID_AF)
+        return registers.bytes[REGISTER_INDEX[id]];
+    else
+        return registers.words[REGISTER_INDEX[id]];
+}
+
+
+/**
+ * Writes a register without dispatching on the register id at runtime. The same restrictions as
+ * for write apply.
+ */
+template<regID_t id>
+void Register::set(u16 value)
+{
+    static_assert(id != RegID_NONE, "Invalid register");
+
+    if constexpr(id < RegID_AF)
+        registers.bytes[REGISTER_INDEX[id]] = value;
+    else
+        registers.words[REGISTER_INDEX[id]] = value;
+
+    if constexpr(id == RegID_F || id == RegID_AF)
+    {
+        lazyFlags = LAZY_NONE;
+        registers.bytes[REGISTER_INDEX[RegID_F]] &= 0xf0;
+    }
+}
+
+
+inline bool Register::getFlagZero() const
+{
+    if(lazyFlags != LAZY_NONE)
+        return lazyResult == 0;
+
+    return registers.bytes[REGISTER_INDEX[RegID_F]] & FLAG_ZERO;
+}
+
+
+inline bool Register::getFlagSub() const
+{
+    if(lazyFlags != LAZY_NONE)
+        return lazyFlags == LAZY_SUB;
+
+    return registers.bytes[REGISTER_INDEX[RegID_F]] & FLAG_SUB;
+}
+
+
+inline bool Register::getFlagHalfCarry() const
+{
+    if(lazyFlags == LAZY_ADD)
+        return (lazyA & 0xf) + (lazyB & 0xf) + lazyCarry > 0xf;
+    else if(lazyFlags == LAZY_SUB)
+        return (lazyB & 0xf) + lazyCarry > (lazyA & 0xf);
+
+    return registers.bytes[REGISTER_INDEX[RegID_F]] & FLAG_HALF_CARRY;
+}
+
+
+inline bool Register::getFlagCarry() const
+{
+    if(lazyFlags == LAZY_ADD)
+        return lazyA + lazyB + lazyCarry > 0xff;
+    else if(lazyFlags == LAZY_SUB)
+        return lazyB + lazyCarry > lazyA;
+
+    return registers.bytes[REGISTER_INDEX[RegID_F]] & FLAG_CARRY;
+}
+
+
+inline void Register::setFlagZero(bool val)
+{
+    materializeFlags();
+    u8& flags = registers.bytes[REGISTER_INDEX[RegID_F]];
+    flags = val ? (flags | FLAG_ZERO) : (flags & ~FLAG_ZERO);
+}
+
+
+inline void Register::setFlagSub(bool val)
+{
+    materializeFlags();
+    u8& flags = registers.bytes[REGISTER_INDEX[RegID_F]];
+    flags = val ? (flags | FLAG_SUB) : (flags & ~FLAG_SUB);
+}
+
+
+inline void Register::setFlagHalfCarry(bool val)
+{
+    materializeFlags();
+    u8& flags = registers.bytes[REGISTER_INDEX[RegID_F]];
+    flags = val ? (flags | FLAG_HALF_CARRY) : (flags & ~FLAG_HALF_CARRY);
+}
+
+
+inline void Register::setFlagCarry(bool val)
+{
+    materializeFlags();
+    u8& flags = registers.bytes[REGISTER_INDEX[RegID_F]];
+    flags = val ? (flags | FLAG_CARRY) : (flags & ~FLAG_CARRY);
+}
+
+
+/**
+ * Overwrites all four flags at once.
+ */
+inline void Register::setFlags(bool zero, bool sub, bool halfCarry, bool carry)
+{
+    lazyFlags = LAZY_NONE;
+    registers.bytes[REGISTER_INDEX[RegID_F]] = (zero ? FLAG_ZERO : 0) | (sub ? FLAG_SUB : 0)
+        | (halfCarry ? FLAG_HALF_CARRY : 0) | (carry ? FLAG_CARRY : 0);
+}
+
+
+inline u8 Register::setFlagsAdd(u8 a, u8 b, bool carry)
+{
+    lazyFlags = LAZY_ADD;
+    lazyA = a;
+    lazyB = b;
+    lazyCarry = carry;
+    lazyResult = a + b + carry;
+    return lazyResult;
+}
+
+
+inline u8 Register::setFlagsSub(u8 a, u8 b, bool carry)
+{
+    lazyFlags = LAZY_SUB;
+    lazyA = a;
+    lazyB = b;
+    lazyCarry = carry;
+    lazyResult = a - b - carry;
+    return lazyResult;
+}
+
+
+/**
+ * Writes the lazily evaluated flags to register F.
+ */
+inline void Register::materializeFlags()
+{
+    if(lazyFlags == LAZY_NONE)
+        return;
+
+    bool zero = getFlagZero();
+    bool sub = getFlagSub();
+    bool halfCarry = getFlagHalfCarry();
+    bool carry = getFlagCarry();
+    setFlags(zero, sub, halfCarry, carry);
+}
+
+
 #endif /* REGISTER_H */
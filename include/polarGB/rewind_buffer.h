@@ -0,0 +1,73 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef REWIND_BUFFER_H
+#define REWIND_BUFFER_H
+
+#include <deque>
+#include <vector>
+#include "types.h"
+
+
+/**
+ * Bounded history of save states for rewinding. Every few snapshots a keyframe is stored, the
+ * snapshots in between only store the XOR difference with their keyframe. Both are compressed by
+ * leaving out the runs of zero bytes, which is most of a difference between nearby frames.
+ *
+ * The compressed snapshots never use more than the capacity, the oldest keyframe and its
+ * differences are dropped to make room. On top of that one uncompressed keyframe is kept.
+ */
+class RewindBuffer
+{
+public:
+    RewindBuffer(size_t capacity, u32 keyframeInterval = 32);
+    ~RewindBuffer();
+
+    void record(const std::vector<u8>& state);
+    bool pop(std::vector<u8>& state);
+    void clear();
+
+    size_t getSnapshotCount() const;
+    size_t getMemoryUsage() const;
+    size_t getCapacity() const;
+
+private:
+    typedef struct Snapshot
+    {
+        bool keyframe;
+        std::vector<u8> data;   /* Compressed state or difference with the keyframe */
+    } snapshot_t;
+
+    size_t capacity;
+    u32 keyframeInterval;
+    std::deque<snapshot_t> snapshots;
+    size_t memoryUsage;
+
+    std::vector<u8> keyframe;   /* Uncompressed state of the newest keyframe */
+    bool keyframeValid;
+    u32 deltasSinceKeyframe;
+    std::vector<u8> encodeBuffer;
+
+    void push(bool keyframe, const std::vector<u8>& state, const std::vector<u8>& reference);
+    void dropOldest();
+    bool loadNewestKeyframe();
+
+    static void encode(const std::vector<u8>& state, const std::vector<u8>& reference, std::vector<u8>& data);
+    static void decode(const std::vector<u8>& data, const std::vector<u8>& reference, std::vector<u8>& state);
+};
+
+#endif /* REWIND_BUFFER_H */
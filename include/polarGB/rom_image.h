@@ -0,0 +1,59 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ROM_IMAGE_H
+#define ROM_IMAGE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include "types.h"
+
+
+/**
+ * Read-only ROM file that is memory mapped. Images are shared per process, opening a file with
+ * the same contents as an image that is still in use returns that image instead of mapping the
+ * file again.
+ *
+ * The mapping is not a snapshot of the file. The file must not be truncated or rewritten while an
+ * image of it is in use: reading a truncated part raises SIGBUS, and rewritten contents can show
+ * up in the image after the decode cache of the Cpu has already cached the old code.
+ */
+class RomImage
+{
+public:
+    ~RomImage();
+
+    static std::shared_ptr<const RomImage> open(const std::string& fileName); /* Can throw a runtime_error. */
+
+    const u8* data() const { return this->mem; }
+    size_t size() const { return this->length; }
+    u64 hash() const { return this->contentHash; }
+
+private:
+    RomImage(const u8* mem, size_t length, u64 contentHash);
+    RomImage(const RomImage&) = delete;
+    RomImage& operator=(const RomImage&) = delete;
+
+    const u8* mem;
+    size_t length;
+    u64 contentHash;
+
+    static u64 hashContents(const u8* mem, size_t length);
+};
+
+#endif /* ROM_IMAGE_H */
@@ -0,0 +1,101 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SAVE_STATE_H
+#define SAVE_STATE_H
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "types.h"
+
+
+const u32 SAVE_STATE_MAGIC = 0x53424750; /* "PGBS" */
+const u32 SAVE_STATE_VERSION = 1;
+
+
+/**
+ * Appends the state of the subsystems to a buffer. Values are stored in the byte order of the
+ * host, a save state is meant to be loaded on the machine that created it.
+ */
+class StateWriter
+{
+public:
+    StateWriter(std::vector<u8>& buffer) : buffer(buffer) {}
+
+    void writeBytes(const void* data, size_t size)
+    {
+        const u8* bytes = static_cast<const u8*>(data);
+        this->buffer.insert(this->buffer.end(), bytes, bytes + size);
+    }
+
+    template<typename T> void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be written");
+        writeBytes(&value, sizeof(T));
+    }
+
+private:
+    std::vector<u8>& buffer;
+};
+
+
+/**
+ * Reads the state of the subsystems from a buffer that was created by a StateWriter. Reading past
+ * the end of the buffer throws a runtime_error.
+ */
+class StateReader
+{
+public:
+    StateReader(const std::vector<u8>& buffer) : buffer(buffer), position(0) {}
+
+    void readBytes(void* data, size_t size)
+    {
+        if(size > this->buffer.size() - this->position)
+            throw std::runtime_error("Save state is truncated");
+
+        std::memcpy(data, this->buffer.data() + this->position, size);
+        this->position += size;
+    }
+
+    template<typename T> T read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be read");
+        static_assert(!std::is_same<T, bool>::value, "Booleans are read with readBool");
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+    /* Not every byte is a valid bool, so the byte is checked before it is converted. */
+    bool readBool()
+    {
+        u8 value = read<u8>();
+        if(value > 1)
+            throw std::runtime_error("Save state has an invalid boolean");
+        return value == 1;
+    }
+
+    bool atEnd() const { return this->position == this->buffer.size(); }
+
+private:
+    const std::vector<u8>& buffer;
+    size_t position;
+};
+
+#endif /* SAVE_STATE_H */
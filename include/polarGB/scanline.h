@@ -0,0 +1,54 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCANLINE_H
+#define SCANLINE_H
+
+#include <array>
+#include <cstddef>
+#include "types.h"
+
+
+/**
+ * A scanline pixel holds the palette in bits 2-3 and the shade index (colour number) in bits 0-1,
+ * which makes it an index in a line palette of 16 colours.
+ */
+const u8 PALETTE_BGP = 0x0;
+const u8 PALETTE_OBP0 = 0x4;
+const u8 PALETTE_OBP1 = 0x8;
+
+typedef std::array<u8, 16> linePalette_t;
+
+
+typedef void (*expandFunction_t)(const u8*, const linePalette_t&, u8*, size_t);
+
+
+linePalette_t makeLinePalette(u8 bgp, u8 obp0, u8 obp1);
+void expandScanline(const u8* pixels, const linePalette_t& palette, u8* output, size_t count);
+void expandScanlineScalar(const u8* pixels, const linePalette_t& palette, u8* output,
+    size_t count);
+
+/* Vector expansions that expandScanline picks from at run time. They are declared for the tests,
+ * a caller has to check that the processor supports their instruction set. */
+#if defined(__x86_64__) || defined(__i386__)
+#define SCANLINE_X86
+void expandScanlineSse2(const u8* pixels, const linePalette_t& palette, u8* output, size_t count);
+void expandScanlineAvx2(const u8* pixels, const linePalette_t& palette, u8* output, size_t count);
+#endif
+
+
+#endif /* SCANLINE_H */
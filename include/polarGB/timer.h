@@ -20,6 +20,7 @@
 
 #include <memory>
 #include "types.h"
+#include "save_state.h"
 #include "interrupt_controller.h"
 
 
@@ -36,12 +37,17 @@ class Timer
 {
 public:
     Timer(std::shared_ptr<InterruptController> interruptController);
+    Timer(const Timer& other, std::shared_ptr<InterruptController> interruptController);
     ~Timer();
 
     void update(u8 cycles);
     u8 read(timerRegister_t reg) const;
     void write(timerRegister_t reg, u8 value);
 
+    /* Save states. */
+    void saveState(StateWriter& state) const;
+    void loadState(StateReader& state);
+
 private:
     /* Registers */
     u8 DIV;     /* Address: 0xff04 */
@@ -0,0 +1,67 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "types.h"
+
+
+/**
+ * Hands frames from one producer thread to one consumer thread without locks. The producer
+ * writes into its own buffer and publishes it by swapping it with the middle buffer, the consumer
+ * swaps its buffer with the middle buffer when a new frame is waiting. Neither side ever waits for
+ * the other, a published frame that is replaced before it is consumed is dropped.
+ */
+class TripleBuffer
+{
+public:
+    TripleBuffer(size_t frameSize);
+    ~TripleBuffer();
+
+    /* Producer */
+    u8* getWriteBuffer();
+    void publish();
+
+    /* Consumer */
+    bool hasNewFrame() const;
+    bool consume();
+    const u8* getReadBuffer() const;
+    std::chrono::steady_clock::time_point getReadPublishTime() const;
+
+    u64 getPublishedFrames() const;
+    u64 getDroppedFrames() const;
+
+private:
+    static const u8 NEW_FRAME = 0x4;    /* Set in middle when it holds an unconsumed frame */
+
+    std::array<std::vector<u8>, 3> buffers;
+    std::array<std::chrono::steady_clock::time_point, 3> publishTimes;
+
+    u8 writeIndex;              /* Owned by the producer */
+    u8 readIndex;               /* Owned by the consumer */
+    std::atomic<u8> middle;     /* Index of the middle buffer and the NEW_FRAME flag */
+
+    std::atomic<u64> publishedFrames;
+    std::atomic<u64> droppedFrames;
+};
+
+#endif /* TRIPLE_BUFFER_H */
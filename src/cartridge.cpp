@@ -38,6 +38,24 @@ Cartridge::Cartridge()
 
 }
 
+/**
+ * Copies the cartridge. The copy shares the ROM image and the external RAM pages with the
+ * original until one of them writes to a page.
+ */
+Cartridge::Cartridge(const Cartridge& other)
+{
+    this->mbc = other.mbc != nullptr ? other.mbc->clone() : nullptr;
+    this->fileSize = other.fileSize;
+    this->fileName = other.fileName;
+    this->gameTitle = other.gameTitle;
+    this->CGBFlag = other.CGBFlag;
+    this->SGBFlag = other.SGBFlag;
+    this->cartridgeType = other.cartridgeType;
+    this->romSize = other.romSize;
+    this->ramSize = other.ramSize;
+    this->destinationCode = other.destinationCode;
+}
+
 Cartridge::~Cartridge()
 {
     this->clear();
@@ -55,19 +73,18 @@ void Cartridge::load(string fileName)
     fmt::print("Loading a new cartridge from file: {}\n", fileName);
     this->fileName = fileName;
 
-    ifstream f;
-    f.open(fileName, ios::in | ios::binary);
-    if(!f.is_open())
+    /* The ROM is mapped read-only and shared with other cartridges that load the same ROM. */
+    shared_ptr<const RomImage> romImage = RomImage::open(fileName);
+    if(romImage->size() < 2 * ROM_BANK_SIZE)
     {
         throw std::runtime_error(
-            fmt::format("Could not open file: '{}'", fileName)
+            fmt::format("File '{}' is too small to be a valid Game Boy ROM.", fileName)
         );
     }
 
-    this->fileSize = getFileSize(&f);
-    processCartridgeHeader(&f);
-    initializeMBC(&f);
-    f.close();
+    this->fileSize = romImage->size();
+    processCartridgeHeader(romImage->data());
+    initializeMBC(romImage);
 }
 
 
@@ -118,28 +135,93 @@ void Cartridge::write(u16 address, u8 data)
 }
 
 
-unsigned int Cartridge::getFileSize(ifstream *f)
+/**
+ * Returns the ROM bank that is mapped at the given ROM address.
+ */
+int Cartridge::getRomBank(u16 address) const
 {
-    unsigned int fileSize = 0;
-    if(f->is_open() && f->good())
-    {
-        f->seekg (0, f->end);
-        fileSize = f->tellg();
-        f->seekg (0, f->beg);
-    }
-    return fileSize;
+    if(this->mbc == nullptr)
+        return address >> 14;
+
+    return this->mbc->getRomBank(address);
 }
 
 
 /**
- * More info can be found here: http://gbdev.gg8.se/wiki/articles/The_Cartridge_Header
+ * Returns the start of the ROM bank that is mapped at the given ROM address, nullptr when no
+ * cartridge is loaded.
+ */
+const u8* Cartridge::getRomBankData(u16 address) const
+{
+    if(this->mbc == nullptr)
+        return nullptr;
+
+    return this->mbc->getRomBankData(address);
+}
+
+
+/**
+ * Returns the external RAM page that is mapped at an address in 0xa000-0xbfff, nullptr when the
+ * RAM can not be accessed directly at the moment.
+ */
+const u8* Cartridge::getRamPage(u16 address) const
+{
+    if(this->mbc == nullptr)
+        return nullptr;
+
+    return this->mbc->getRamPage(address);
+}
+
+
+/**
+ * Returns the external RAM page at an address for writing, nullptr when it can not be written
+ * directly. For example when the page is still shared with a copy of the cartridge.
+ */
+u8* Cartridge::getWritableRamPage(u16 address)
+{
+    if(this->mbc == nullptr)
+        return nullptr;
+
+    return this->mbc->getWritableRamPage(address);
+}
+
+
+/**
+ * Returns true if the cartridge has external RAM.
  */
-void Cartridge::processCartridgeHeader(ifstream *f)
+bool Cartridge::hasRam() const
 {
-    u8* buffer = new u8[0x150];
-    f->seekg(0, f->beg);
-    f->read((char *)buffer, 0x150);
+    return this->mbc != nullptr && this->mbc->hasRam();
+}
+
+
+void Cartridge::saveState(StateWriter& state) const
+{
+    if(this->mbc == nullptr)
+        throw std::runtime_error("No cartridge is loaded");
+
+    state.write<u8>(this->cartridgeType);
+    this->mbc->saveState(state);
+}
+
+
+void Cartridge::loadState(StateReader& state)
+{
+    if(this->mbc == nullptr)
+        throw std::runtime_error("No cartridge is loaded");
+
+    if(state.read<u8>() != this->cartridgeType)
+        throw std::runtime_error("Save state was created with a different cartridge type");
+
+    this->mbc->loadState(state);
+}
 
+
+/**
+ * More info can be found here: http://gbdev.gg8.se/wiki/articles/The_Cartridge_Header
+ */
+void Cartridge::processCartridgeHeader(const u8* buffer)
+{
     /* Read the game title. */
     this->gameTitle = "";
     this->gameTitle = string((char *)(buffer + 0x134), 0x144 - 0x134);
@@ -150,8 +232,6 @@ void Cartridge::processCartridgeHeader(ifstream *f)
     ramSize = buffer[0x149];
     destinationCode = buffer[0x14a];
     this->checksum(buffer);
-
-    delete[] buffer;
 }
 
 
@@ -162,7 +242,7 @@ void Cartridge::printInfo()
 }
 
 
-bool Cartridge::checksum(u8* buffer)
+bool Cartridge::checksum(const u8* buffer)
 {
     u8 checksum = 0x19;
     for(u16 addr = 0x0134; addr <= 0x014d; addr++)
@@ -180,7 +260,7 @@ bool Cartridge::checksum(u8* buffer)
 }
 
 
-void Cartridge::initializeMBC(std::ifstream *f)
+void Cartridge::initializeMBC(shared_ptr<const RomImage> romImage)
 {
     int romSizeInBytes = 0x8000 * (1 << this->romSize);
     int ramSizeInBytes = 0;
@@ -189,6 +269,10 @@ void Cartridge::initializeMBC(std::ifstream *f)
             ramSizeInBytes = 0;
             break;
 
+        case 0x1:
+            ramSizeInBytes = 0x800;
+            break;
+
         case 0x2:
             ramSizeInBytes = 0x2000;
             break;
@@ -208,7 +292,37 @@ void Cartridge::initializeMBC(std::ifstream *f)
 
     switch (cartridgeType) {
         case 0x0:
-            this->mbc = new NoMBC(romSizeInBytes, ramSizeInBytes);
+        case 0x8:
+        case 0x9:
+            this->mbc = new NoMBC(romImage, romSizeInBytes, ramSizeInBytes);
+            break;
+
+        case 0x1:
+        case 0x2:
+        case 0x3:
+            this->mbc = new MBC1(romImage, romSizeInBytes, ramSizeInBytes);
+            break;
+
+        case 0x5:
+        case 0x6:
+            this->mbc = new MBC2(romImage, romSizeInBytes);
+            break;
+
+        case 0xf:
+        case 0x10:
+        case 0x11:
+        case 0x12:
+        case 0x13:
+            this->mbc = new MBC3(romImage, romSizeInBytes, ramSizeInBytes);
+            break;
+
+        case 0x19:
+        case 0x1a:
+        case 0x1b:
+        case 0x1c:
+        case 0x1d:
+        case 0x1e:
+            this->mbc = new MBC5(romImage, romSizeInBytes, ramSizeInBytes);
             break;
 
         default:
@@ -216,6 +330,4 @@ void Cartridge::initializeMBC(std::ifstream *f)
             exit(EXIT_FAILURE);
             break;
     }
-
-    this->mbc->loadROM(f);
 }
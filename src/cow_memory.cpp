@@ -0,0 +1,86 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include "polarGB/cow_memory.h"
+
+
+using namespace std;
+
+
+CowMemory::CowMemory()
+{
+}
+
+
+CowMemory::CowMemory(size_t size)
+{
+    assert(size % COW_PAGE_SIZE == 0);
+
+    this->pages.resize(size / COW_PAGE_SIZE);
+    for(shared_ptr<page_t>& page : this->pages)
+        page = make_shared<page_t>();
+}
+
+
+void CowMemory::clear()
+{
+    this->pages.clear();
+}
+
+
+/**
+ * Returns a page that can be written to. A page that is shared with another copy of the memory
+ * is copied first.
+ */
+u8* CowMemory::getWritablePage(size_t address)
+{
+    assert(address < this->size());
+
+    shared_ptr<page_t>& page = this->pages[address / COW_PAGE_SIZE];
+    if(page.use_count() > 1)
+        page = make_shared<page_t>(*page);
+    else
+    {
+        /* Another thread may just have copied this page and released it, make its reads of the
+         * page happen before our writes. */
+        atomic_thread_fence(memory_order_acquire);
+    }
+
+    return page->data();
+}
+
+
+bool CowMemory::isPageShared(size_t address) const
+{
+    assert(address < this->size());
+    return this->pages[address / COW_PAGE_SIZE].use_count() > 1;
+}
+
+
+void CowMemory::saveState(StateWriter& state) const
+{
+    for(const shared_ptr<page_t>& page : this->pages)
+        state.write(*page);
+}
+
+
+void CowMemory::loadState(StateReader& state)
+{
+    for(size_t address = 0; address < this->size(); address += COW_PAGE_SIZE)
+        state.readBytes(getWritablePage(address), COW_PAGE_SIZE);
+}
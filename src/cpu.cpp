@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include <cassert>
+#include <stdexcept>
 #include <fmt/format.h>
 #include "polarGB/cpu.h"
 
@@ -31,8 +32,10 @@ Cpu::Cpu(std::shared_ptr<Mmu> m, std::shared_ptr<InterruptController> ic)
     this->mmu = m;
     this->interruptController = ic;
     this->interruptController->disableInterrupts();
-    this->currentInstruction = new instruction_t;
     this->state = on;
+    this->instructionCycles = 0;
+    this->specialisedHandlers = true;
+    this->decodeCacheStats = {0, 0, 0, 0, 0};
 
     /* Initialise the registers. */
     this->reg = Register();
@@ -44,6 +47,24 @@ Cpu::Cpu(std::shared_ptr<Mmu> m, std::shared_ptr<InterruptController> ic)
     this->reg.write(RegID_PC, 0x100);     /* Initialise the program counter */
 }
 
+/**
+ * Forks a cpu that executes from the given memory. Only the registers and the state are copied,
+ * the decode cache of the fork starts empty.
+ */
+Cpu::Cpu(const Cpu& other, std::shared_ptr<Mmu> m, std::shared_ptr<InterruptController> ic)
+{
+    assert(m != nullptr);
+    assert(ic != nullptr);
+
+    this->mmu = m;
+    this->interruptController = ic;
+    this->state = other.state;
+    this->instructionCycles = other.instructionCycles;
+    this->specialisedHandlers = other.specialisedHandlers;
+    this->decodeCacheStats = {0, 0, 0, 0, 0};
+    this->reg = other.reg;
+}
+
 Cpu::~Cpu()
 {
 }
@@ -51,8 +72,7 @@ Cpu::~Cpu()
 
 void Cpu::shutDown()
 {
-    delete this->currentInstruction;
-    this->currentInstruction = nullptr;
+    this->clearDecodeCache();
 
     this->interruptController = nullptr;
     this->mmu = nullptr;
@@ -75,9 +95,11 @@ u8 Cpu::step()
 
         // printInstructionInfo(instr);
 
-        /* Execute the instruction handler. */
+        /* Execute the instruction handler. The instruction is owned by the decode cache, so
+         * handlers report a different cycle cost through instructionCycles. */
+        this->instructionCycles = instr->cycleCost;
         (this->*(instr->executionFunction))(instr);
-        cycleCost = instr->cycleCost;
+        cycleCost = this->instructionCycles;
     }
 
     /* Check for interrupts before fetching the next instruction. This possibly changes the
@@ -88,19 +110,248 @@ u8 Cpu::step()
 }
 
 
+decodeCacheStats_t Cpu::getDecodeCacheStats() const
+{
+    return this->decodeCacheStats;
+}
+
+
+void Cpu::setSpecialisedHandlers(bool enable)
+{
+    /* Cached instructions refer to the handlers of the previous setting. */
+    if(this->specialisedHandlers != enable)
+        this->clearDecodeCache();
+
+    this->specialisedHandlers = enable;
+}
+
+
+bool Cpu::getSpecialisedHandlers() const
+{
+    return this->specialisedHandlers;
+}
+
+
+void Cpu::saveState(StateWriter& state)
+{
+    state.write<u8>(this->state);
+    this->reg.saveState(state);
+}
+
+
+/**
+ * Restores the CPU. The decoded RAM pages become invalid because the Mmu changes the page
+ * versions when it loads its state, decoded ROM pages stay valid.
+ */
+void Cpu::loadState(StateReader& state)
+{
+    u8 cpuState = state.read<u8>();
+    if(cpuState > halt)
+        throw std::runtime_error("Save state has an invalid CPU state");
+    this->state = static_cast<CpuState>(cpuState);
+    this->reg.loadState(state);
+}
+
+
+/**
+ * Executes a basic block of instructions and returns the amount of CPU cycles used. Interrupts are
+ * checked once the block has finished. Falls back to a single step when no block can be built at
+ * the program counter.
+ */
+u8 Cpu::runBlock()
+{
+    if(this->state == halt)
+        return step();
+
+    u16 pc = reg.read(RegID_PC);
+    u8 index = pc & 0xff;
+    decodeCachePage_t* page = getDecodeCachePage(pc);
+
+    u8 length = page->blockLengths[index];
+    if(length == 0)
+    {
+        length = buildBlock(page, pc);
+        if(length == 0)
+            return step();
+    }
+
+    this->decodeCacheStats.blocksExecuted++;
+
+    u8 cycleCost = 0;
+    for(u8 i = 0; i < length; i++)
+    {
+        instruction_t* instr = &page->instructions[index];
+        reg.write(RegID_PC, instr->memoryLocation + instr->instructionLength);
+
+        this->instructionCycles = instr->cycleCost;
+        (this->*(instr->executionFunction))(instr);
+        cycleCost += this->instructionCycles;
+
+        /* Stop when the block has overwritten its own code or switched away its ROM bank. */
+        if(getPageKey(pc) != page->version)
+            break;
+
+        index += instr->instructionLength;
+    }
+
+    this->checkInterrupts();
+
+    return cycleCost;
+}
+
+
+/**
+ * Returns the decoded instruction at the program counter. Instructions are decoded once and
+ * served from the decode cache afterwards.
+ */
 Cpu::instruction_t * Cpu::fetchDecode()
 {
-    /* Get the program counter. */
     u16 pc = reg.read(RegID_PC);
+    return getCachedInstruction(getDecodeCachePage(pc), pc);
+}
+
+
+/**
+ * Returns the decoded instruction at an address within the decode cache page, the instruction
+ * is decoded when the page does not contain it yet.
+ */
+Cpu::instruction_t* Cpu::getCachedInstruction(decodeCachePage_t* page, u16 address)
+{
+    u8 index = address & 0xff;
+    instruction_t* instr = &page->instructions[index];
+    if(page->valid[index])
+    {
+        this->decodeCacheStats.hits++;
+        return instr;
+    }
 
     /* Fetch the next instruction from memory. */
-    u8 opcode = mmu->read(pc);
+    this->decodeCacheStats.misses++;
+    u8 opcode = mmu->read(address);
+
+    instr->memoryLocation = address;
+    instr->opcode = opcode;
+    decodeOpcode(instr, opcode);
+
+    /* Instructions that continue on the next page depend on memory that this page does not
+     * track. Within a ROM bank the next page is immutable, everywhere else these instructions are
+     * decoded on every execution. */
+    if(address <= ROM_END_ADDR)
+        page->valid[index] = (address & 0x3fff) + instr->instructionLength <= 0x4000;
+    else
+        page->valid[index] = index + instr->instructionLength <= 0x100;
+
+    return instr;
+}
+
+
+/**
+ * Returns the decode cache page for an address. ROM pages are looked up by the ROM bank that is
+ * currently mapped, RAM pages are reset when the memory page was written to since decoding.
+ */
+Cpu::decodeCachePage_t* Cpu::getDecodeCachePage(u16 address)
+{
+    u32 key = getPageKey(address);
+
+    if(address <= ROM_END_ADDR)
+    {
+        if(key >= this->romDecodeCache.size())
+            this->romDecodeCache.resize(key + 1);
+
+        std::unique_ptr<decodeCachePage_t>& page = this->romDecodeCache[key];
+        if(page == nullptr)
+        {
+            page = std::make_unique<decodeCachePage_t>();
+            page->version = key;
+        }
+
+        return page.get();
+    }
+
+    std::unique_ptr<decodeCachePage_t>& page = this->ramDecodeCache[(address - ROM_END_ADDR - 1) >> 8];
+    if(page == nullptr)
+    {
+        page = std::make_unique<decodeCachePage_t>();
+        page->version = key;
+    }
+    else if(page->version != key)
+    {
+        page->valid.reset();
+        page->blockLengths.fill(0);
+        page->version = key;
+        this->decodeCacheStats.invalidations++;
+    }
+
+    return page.get();
+}
+
+
+void Cpu::clearDecodeCache()
+{
+    this->romDecodeCache.clear();
+    for(std::unique_ptr<decodeCachePage_t>& page : this->ramDecodeCache)
+        page = nullptr;
+}
+
+
+/**
+ * Returns the key that identifies the contents of a memory page, the physical ROM page for ROM
+ * addresses and the write version of the page for other addresses.
+ */
+u32 Cpu::getPageKey(u16 address) const
+{
+    if(address <= ROM_END_ADDR)
+        return mmu->getRomPage(address);
+
+    return mmu->getPageVersion(address);
+}
+
+
+/**
+ * Decodes the straight line run of instructions starting at an address. The block ends at the
+ * first control flow instruction, at the end of the page or at an instruction that can not be
+ * cached. Returns the number of instructions in the block.
+ */
+u8 Cpu::buildBlock(decodeCachePage_t* page, u16 address)
+{
+    u8 startIndex = address & 0xff;
+    u8 length = 0;
 
-    currentInstruction->memoryLocation = pc;
-    currentInstruction->opcode = opcode;
-    decodeOpcode(currentInstruction, opcode);
+    while(length < MAX_BLOCK_LENGTH)
+    {
+        u8 index = address & 0xff;
+        instruction_t* instr = getCachedInstruction(page, address);
+        if(!page->valid[index])
+            break;
+
+        length++;
+        if(endsBlock(instr) || index + instr->instructionLength > 0xff)
+            break;
+
+        address += instr->instructionLength;
+    }
+
+    page->blockLengths[startIndex] = length;
+    if(length > 0)
+        this->decodeCacheStats.blocksBuilt++;
 
-    return currentInstruction;
+    return length;
+}
+
+
+/**
+ * Returns true for instructions after which execution can not continue at the next address or
+ * after which pending interrupts have to be checked.
+ */
+bool Cpu::endsBlock(const instruction_t* instr)
+{
+    return instr->executionFunction == &Cpu::executeJP
+        || instr->executionFunction == &Cpu::executeJR
+        || instr->executionFunction == &Cpu::executeCALL
+        || instr->executionFunction == &Cpu::executeRET
+        || instr->executionFunction == &Cpu::executeHALT
+        || instr->executionFunction == &Cpu::executeEI
+        || instr->executionFunction == &Cpu::executeDI;
 }
 
 
@@ -163,6 +414,12 @@ CpuState Cpu::getState() const
 }
 
 
+u16 Cpu::readRegister(regID_t id)
+{
+    return this->reg.read(id);
+}
+
+
 u8 Cpu::loadOperand8bits(operand_t* operand)
 {
     switch(operand->type)
@@ -175,6 +432,8 @@ u8 Cpu::loadOperand8bits(operand_t* operand)
             return reg.read(operand->reg);
         case OP_MEM:
             return mmu->read(reg.read(operand->memPtr));
+        case OP_HIGH_MEM:
+            return mmu->read(0xff00 + reg.read(operand->memPtr));
         case OP_NONE:
         default:
             return 0;
@@ -214,6 +473,9 @@ void Cpu::storeOperand8bits(operand_t* operand, u8 value)
         case OP_MEM:
             mmu->write(reg.read(operand->memPtr), value);
             break;
+        case OP_HIGH_MEM:
+            mmu->write(0xff00 + reg.read(operand->memPtr), value);
+            break;
         case OP_IMM_PTR:
             mmu->write(operand->immediate, value);
             break;
@@ -329,7 +591,7 @@ void Cpu::executeJP(instruction_t* instr)
         }
         else
         {
-            instr->cycleCost = 3;
+            this->instructionCycles = 3;
         }
     }
 }
@@ -354,7 +616,7 @@ void Cpu::executeJR(instruction_t* instr)
     }
     else
     {
-        instr->cycleCost = 2;
+        this->instructionCycles = 2;
     }
 }
 
@@ -381,7 +643,7 @@ void Cpu::executeCALL(instruction_t* instr)
     }
     else
     {
-        instr->cycleCost = 3;
+        this->instructionCycles = 3;
     }
 }
 
@@ -401,11 +663,7 @@ void Cpu::executeRET(instruction_t* instr)
     ||(conditionFlag == COND_C  && carry == true))
     {
         /* Pop the old program counter from the stack. */
-        instr->operandSrc.type = OP_MEM;
-        instr->operandSrc.memPtr = RegID_SP;
-        instr->operandDst.type = OP_REG;
-        instr->operandDst.reg = RegID_PC;
-        this->executePOP(instr);
+        reg.write(RegID_PC, _executePOP());
 
         /* Re-enable the IME flag if the instruction originated from an interrupt. */
         if(conditionFlag == COND_IE)
@@ -413,7 +671,7 @@ void Cpu::executeRET(instruction_t* instr)
     }
     else
     {
-        instr->cycleCost = 2;
+        this->instructionCycles = 2;
     }
 }
 
@@ -423,18 +681,11 @@ void Cpu::executeRET(instruction_t* instr)
  */
 void Cpu::executeADD8(instruction_t* instr)
 {
-    u16 param1 = (u16)loadOperand8bits(&(instr->operandSrc));
-    u16 param2 = (u16)loadOperand8bits(&(instr->operandDst));
-    u8 result = (u8) (0xff & (param1 + param2));
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0);                       /* Set flag if the result equals 0. */
-    reg.setFlagSub(false);                              /* Always reset the Sub flag. */;
-    reg.setFlagCarry(param1 + param2 > 0xff);
-    reg.setFlagHalfCarry((param1 & 0xf) + (param2 & 0xf) > 0xf);
+    u8 param1 = loadOperand8bits(&(instr->operandSrc));
+    u8 param2 = loadOperand8bits(&(instr->operandDst));
 
     /* Store the addition. */
-    storeOperand8bits(&(instr->operandDst), result);
+    storeOperand8bits(&(instr->operandDst), aluAdd(param1, param2, false));
 }
 
 
@@ -443,21 +694,11 @@ void Cpu::executeADD8(instruction_t* instr)
  */
 void Cpu::executeADC(instruction_t* instr)
 {
-    u16 param1 = (u16)loadOperand8bits(&(instr->operandSrc));
-    u16 param2 = (u16)loadOperand8bits(&(instr->operandDst));
-    u8 carry = 0;
-    if(reg.getFlagCarry())
-        carry = 1;
-    u8 result = (u8) (0xff & (param1 + param2 + carry));
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0);                       /* Set flag if the result equals 0. */
-    reg.setFlagSub(false);                              /* Always reset the Sub flag. */;
-    reg.setFlagCarry(param1 + param2 + carry > 0xff);
-    reg.setFlagHalfCarry((param1 & 0xf) + (param2 & 0xf) + carry > 0xf);
+    u8 param1 = loadOperand8bits(&(instr->operandSrc));
+    u8 param2 = loadOperand8bits(&(instr->operandDst));
 
     /* Store the addition. */
-    storeOperand8bits(&(instr->operandDst), result);
+    storeOperand8bits(&(instr->operandDst), aluAdd(param1, param2, reg.getFlagCarry()));
 }
 
 
@@ -466,18 +707,8 @@ void Cpu::executeADC(instruction_t* instr)
  */
 void Cpu::executeSUB(instruction_t* instr)
 {
-    u8 param1 = reg.read(RegID_A);
-    u8 param2 = loadOperand8bits(&(instr->operandSrc));
-    u8 result = param1 - param2;
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0); /* Set flag if the result equals 0. */
-    reg.setFlagSub(true);               /* Always set the Sub flag. */
-    reg.setFlagHalfCarry((param2 & 0xf) > (param1 & 0xf));
-    reg.setFlagCarry(param2 > param1);
-
-    /* Store the addition. */
-    reg.write(RegID_A, result);
+    u8 param = loadOperand8bits(&(instr->operandSrc));
+    reg.write(RegID_A, aluSub(reg.read(RegID_A), param, false));
 }
 
 
@@ -486,21 +717,8 @@ void Cpu::executeSUB(instruction_t* instr)
  */
 void Cpu::executeSBC(instruction_t* instr)
 {
-    u8 param1 = reg.read(RegID_A);
-    u8 param2 = loadOperand8bits(&(instr->operandSrc));
-    u8 carry = 0;
-    if(reg.getFlagCarry())
-        carry = 1;
-    u8 result = param1 - param2 - carry;
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0); /* Set flag if the result equals 0. */
-    reg.setFlagSub(true); /* Always set the Sub flag. */
-    reg.setFlagHalfCarry((param2 & 0xf) + carry > (param1 & 0xf));
-    reg.setFlagCarry((u16)param2 + (u16)carry > (u16)param1);
-
-    /* Store the addition. */
-    reg.write(RegID_A, result);
+    u8 param = loadOperand8bits(&(instr->operandSrc));
+    reg.write(RegID_A, aluSub(reg.read(RegID_A), param, reg.getFlagCarry()));
 }
 
 
@@ -509,17 +727,8 @@ void Cpu::executeSBC(instruction_t* instr)
  */
 void Cpu::executeAND(instruction_t* instr)
 {
-    /* Bitwise AND. */
-    u8 result = loadOperand8bits(&(instr->operandSrc)) & reg.read(RegID_A);
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0);
-    reg.setFlagSub(false);
-    reg.setFlagHalfCarry(true);
-    reg.setFlagCarry(false);
-
-    /* Store the result. */
-    reg.write(RegID_A, result);
+    u8 param = loadOperand8bits(&(instr->operandSrc));
+    reg.write(RegID_A, aluAnd(reg.read(RegID_A), param));
 }
 
 
@@ -528,17 +737,8 @@ void Cpu::executeAND(instruction_t* instr)
  */
 void Cpu::executeXOR(instruction_t* instr)
 {
-    /* Bitwise xor. */
-    u8 result = reg.read(RegID_A) ^ loadOperand8bits(&(instr->operandSrc));
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0);
-    reg.setFlagSub(false);
-    reg.setFlagHalfCarry(false);
-    reg.setFlagCarry(false);
-
-    /* Store the result. */
-    reg.write(RegID_A, result);
+    u8 param = loadOperand8bits(&(instr->operandSrc));
+    reg.write(RegID_A, aluXor(reg.read(RegID_A), param));
 }
 
 
@@ -547,61 +747,98 @@ void Cpu::executeXOR(instruction_t* instr)
  */
 void Cpu::executeOR(instruction_t* instr)
 {
-    /* Bitwise or. */
-    u8 result = reg.read(RegID_A) | loadOperand8bits(&(instr->operandSrc));
-
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0);
-    reg.setFlagSub(false);
-    reg.setFlagHalfCarry(false);
-    reg.setFlagCarry(false);
-
-    /* Store the result. */
-    reg.write(RegID_A, result);
+    u8 param = loadOperand8bits(&(instr->operandSrc));
+    reg.write(RegID_A, aluOr(reg.read(RegID_A), param));
 }
 
 
 /**
- * Execute the CP instruction and set the flags based on the result.
+ * Execute the CP instruction and set the flags based on the result. CP is a subtraction that
+ * discards the result.
  */
 void Cpu::executeCP(instruction_t* instr)
 {
-    /* Input values. */
     u8 val = loadOperand8bits(&(instr->operandSrc));
-    u8 registerA = reg.read(RegID_A);
+    aluSub(reg.read(RegID_A), val, false);
+}
 
-    reg.setFlagZero(registerA == val);
-    reg.setFlagSub(true);
 
-    reg.setFlagHalfCarry((registerA & 0xf) < (val & 0xf));
-    reg.setFlagCarry(registerA < val);
+void Cpu::executeINC8(instruction_t* instr)
+{
+    u8 param = loadOperand8bits(&(instr->operandDst));
+    storeOperand8bits(&(instr->operandDst), aluInc(param));
 }
 
 
-void Cpu::executeINC8(instruction_t* instr)
+void Cpu::executeDEC8(instruction_t* instr)
 {
-    u16 param = (u16)loadOperand8bits(&(instr->operandDst));
-    u8 result = (u8) (0xff & (param + 1));
+    u8 param = loadOperand8bits(&(instr->operandDst));
+    storeOperand8bits(&(instr->operandDst), aluDec(param));
+}
 
-    reg.setFlagZero(result == 0);
-    reg.setFlagSub(false);
-    reg.setFlagHalfCarry((param & 0xf) == 0xf);
 
-    storeOperand8bits(&(instr->operandDst), result);
+/**
+ * Adds two values and the carry bit, sets the flags and returns the 8 bit result. The flags are
+ * only computed when they are read.
+ */
+u8 Cpu::aluAdd(u8 a, u8 b, bool carry)
+{
+    return reg.setFlagsAdd(a, b, carry);
 }
 
 
-void Cpu::executeDEC8(instruction_t* instr)
+/**
+ * Subtracts a value and the carry bit from another value, sets the flags and returns the result.
+ */
+u8 Cpu::aluSub(u8 a, u8 b, bool carry)
 {
-    u8 param = loadOperand8bits(&(instr->operandDst));
-    u8 result = param - 1;
+    return reg.setFlagsSub(a, b, carry);
+}
 
-    /* Set or reset the flags. */
-    reg.setFlagZero(result == 0); /* Set flag if the result equals 0. */
-    reg.setFlagSub(true);               /* Always set the Sub flag. */
-    reg.setFlagHalfCarry((param & 0xf) == 0);
 
-    storeOperand8bits(&(instr->operandDst), result);
+u8 Cpu::aluAnd(u8 a, u8 b)
+{
+    u8 result = a & b;
+    reg.setFlags(result == 0, false, true, false);
+    return result;
+}
+
+
+u8 Cpu::aluXor(u8 a, u8 b)
+{
+    u8 result = a ^ b;
+    reg.setFlags(result == 0, false, false, false);
+    return result;
+}
+
+
+u8 Cpu::aluOr(u8 a, u8 b)
+{
+    u8 result = a | b;
+    reg.setFlags(result == 0, false, false, false);
+    return result;
+}
+
+
+/**
+ * Increments a value by one, the carry flag is not affected.
+ */
+u8 Cpu::aluInc(u8 value)
+{
+    u8 result = value + 1;
+    reg.setFlags(result == 0, false, (value & 0xf) == 0xf, reg.getFlagCarry());
+    return result;
+}
+
+
+/**
+ * Decrements a value by one, the carry flag is not affected.
+ */
+u8 Cpu::aluDec(u8 value)
+{
+    u8 result = value - 1;
+    reg.setFlags(result == 0, true, (value & 0xf) == 0, reg.getFlagCarry());
+    return result;
 }
 
 
@@ -764,15 +1001,24 @@ void Cpu::_executePUSH(u16 val)
  * Pops 2 bytes from the stack. The stack grows down.
  */
 void Cpu::executePOP(instruction_t* instr)
+{
+    storeOperand16bits(&instr->operandDst, _executePOP());
+}
+
+
+/**
+ * Pops 2 bytes from the stack and returns them.
+ */
+u16 Cpu::_executePOP()
 {
     /* Pop value from stack. */
-    u16 val = loadOperand16bits(&instr->operandSrc);
+    u16 sp = reg.read(RegID_SP);
+    u16 val = mmu->read2Bytes(sp);
 
     /* Increases the stack pointer by two. */
-    reg.write(RegID_SP, reg.read(RegID_SP) + 2);
+    reg.write(RegID_SP, sp + 2);
 
-    /* Store result in register. */
-    storeOperand16bits(&instr->operandDst, val);
+    return val;
 }
 
 
@@ -15,8 +15,16 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <fstream>
+#include <algorithm>
+#include <cassert>
 #include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
 #include <fmt/format.h>
 #include "polarGB/emulator.h"
 
@@ -24,10 +32,25 @@
 using namespace std;
 
 
-Emulator::Emulator()
+/* Time before a frame deadline that the pacer stops sleeping and starts spinning. */
+const chrono::microseconds PACER_SPIN_TIME(500);
+
+/* Longest time the main thread waits for a frame before it processes the input again. */
+const chrono::milliseconds INPUT_POLL_TIME(4);
+
+
+Emulator::Emulator() : Emulator(EmulatorOptions())
 {
+}
+
+Emulator::Emulator(const EmulatorOptions& options)
+{
+    this->options = options;
     this->isRunning = false;
     this->cyclesCompleted = 0;
+    this->framesCompleted = 0;
+    this->totalCycles = 0;
+    this->lastStateSize = 0;
     this->mmu = nullptr;
     this->cpu = nullptr;
     this->graphicsController = nullptr;
@@ -38,19 +61,24 @@ Emulator::Emulator()
 
 Emulator::~Emulator()
 {
+    if(this->cpu != nullptr)
+        this->shutDown();
 }
 
 
 int Emulator::start(string cartridgePath)
 {
-    /* Initialise all the subsystems of the gameboy emulator. */
-    this->startUp();
-
-    /* Load the game cartridge. */
-    this->mmu->loadRom(cartridgePath);
+    /* Initialise all the subsystems and load the game cartridge. */
+    this->loadCartridge(cartridgePath);
 
     /* Enter the emulator loop. */
-    this->run();
+    if(this->options.headless)
+        this->runHeadless();
+    else
+        this->run();
+
+    if(this->options.printStats)
+        this->printStats();
 
     /* Shut down the gameboy emulator. */
     this->shutDown();
@@ -58,17 +86,44 @@ int Emulator::start(string cartridgePath)
 }
 
 
+/**
+ * Prints the counters of the caches and the display, for tuning.
+ */
+void Emulator::printStats() const
+{
+    decodeCacheStats_t stats = this->cpu->getDecodeCacheStats();
+    u64 lookups = stats.hits + stats.misses;
+    fmt::print("Decode cache: {} hits, {} misses ({:.2f}% hit rate), {} invalidated pages\n",
+        stats.hits, stats.misses, lookups > 0 ? 100.0 * stats.hits / lookups : 0.0, stats.invalidations);
+    fmt::print("Block cache: {} blocks built, {} blocks executed\n", stats.blocksBuilt, stats.blocksExecuted);
+
+    if(!this->options.headless)
+    {
+        presentStats_t presentStats = this->graphicsController->getPresentStats();
+        fmt::print("Display: {} frames presented, {} dropped, {:.2f} ms average and {:.2f} ms max latency\n",
+            presentStats.framesPresented, presentStats.framesDropped,
+            presentStats.averageLatency * 1e3, presentStats.maxLatency * 1e3);
+    }
+}
+
+
 void Emulator::startUp()
 {
     this->isRunning = true;
     this->cyclesCompleted = 0;
+    this->framesCompleted = 0;
+    this->totalCycles = 0;
 
     this->interruptController = std::make_shared<InterruptController>();
     this->joypad = std::make_shared<Joypad>(this->interruptController);
     this->timer = std::make_shared<Timer>(this->interruptController);
-    this->graphicsController = std::make_shared<GraphicsController>(this->interruptController, false);
+    this->graphicsController = std::make_shared<GraphicsController>(this->interruptController, this->options.headless);
     this->mmu = std::make_shared<Mmu>(this->graphicsController, this->interruptController, this->timer, this->joypad);
     this->cpu = std::make_shared<Cpu>(this->mmu, this->interruptController);
+    this->graphicsController->setFrameSkip(this->options.frameSkip);
+
+    if(this->options.rewindMemory > 0)
+        this->rewindBuffer = std::make_unique<RewindBuffer>(this->options.rewindMemory);
 }
 
 
@@ -84,58 +139,456 @@ void Emulator::shutDown()
     this->timer.reset();
     this->joypad.reset();
     this->interruptController.reset();
+    this->rewindBuffer.reset();
 }
 
 
+/**
+ * Runs the emulator with a window. SDL only allows the window and its events on the main thread,
+ * so the main thread presents the frames and processes the input while the emulation runs paced
+ * on a thread of its own.
+ */
 void Emulator::run()
 {
-    chrono::time_point<chrono::high_resolution_clock> start, end;
+    exception_ptr emulationError = nullptr;
+    thread emulation([this, &emulationError]
+    {
+        try
+        {
+            this->runPaced();
+        }
+        catch(...)
+        {
+            emulationError = current_exception();
+        }
+        this->isRunning = false;
+    });
+
+    while(this->isRunning)
+    {
+        this->graphicsController->presentNextFrame(INPUT_POLL_TIME);
+        this->joypad->processInput();
+        if(this->joypad->getButtonQuit())
+            this->isRunning = false;
+    }
+
+    emulation.join();
+    if(emulationError != nullptr)
+        rethrow_exception(emulationError);
+}
+
+
+/**
+ * Runs the emulator at the speed multiplier, on the emulation thread of run.
+ */
+void Emulator::runPaced()
+{
+    chrono::time_point<chrono::steady_clock> start, end, lastPresentation;
     chrono::duration<double> elapsed_time;
 
     /* Delta time takes into account that the elapsed_time > FRAME_TIME. If we reset the start time
      * of the frame we can lose a little bit of time. This variable calculates this difference
      * and helps make our timing function more accurate. */
     double delta_time = 0.0;
-    start = chrono::high_resolution_clock::now();
+    start = chrono::steady_clock::now();
+    lastPresentation = start;
+    u64 framesSincePresentation = 0;
 
     while(this->isRunning)
     {
+        /* Sleep until the next frame is due. */
+        double speed = this->options.speed;
+        double frameTime = speed > 0.0 ? FRAME_TIME / speed : 0.0;
+        if(frameTime - delta_time > 0.0)
+        {
+            chrono::duration<double> waitTime(frameTime - delta_time);
+            waitUntil(start + chrono::duration_cast<chrono::steady_clock::duration>(waitTime));
+        }
+
         /* Measure the elapsed time. */
-        end = chrono::high_resolution_clock::now();
+        end = chrono::steady_clock::now();
         elapsed_time = end - start;
 
-        /* Check if we need to run the gameboy for an entire frame. */
-        if(elapsed_time.count() + delta_time >= FRAME_TIME)
-        {
-            /* Reset the timer and calculate the time we lost sleeping. */
-            start = chrono::high_resolution_clock::now();
-            delta_time = elapsed_time.count() + delta_time - FRAME_TIME;
+        /* Reset the timer and calculate the time we lost sleeping. */
+        start = end;
+        delta_time = speed > 0.0 ? elapsed_time.count() + delta_time - frameTime : 0.0;
 
-            runFrame();
+        /* When running faster than normal, frames are only presented at the normal frame
+         * rate. */
+        bool present = false;
+        if(speed > 0.0)
+            present = ++framesSincePresentation >= max(1.0, round(speed));
+        else
+            present = chrono::duration<double>(start - lastPresentation).count() >= FRAME_TIME;
+
+        if(present)
+        {
+            framesSincePresentation = 0;
+            lastPresentation = start;
         }
+
+        /* Holding the rewind button loads the previous snapshot and shows its next frame, this
+         * rewinds a few times faster than the game runs. */
+        bool rewinding = this->joypad->getButtonRewind() && rewind();
+
+        this->graphicsController->setFramePresentation(present || rewinding);
+        runFrame();
+        if(!rewinding)
+            recordRewindSnapshot();
+        if(this->options.frameLimit > 0 && framesCompleted >= this->options.frameLimit)
+            this->isRunning = false;
+    }
+}
+
+
+/**
+ * Sleeps until the deadline. The thread wakes up slightly early and spins for the remaining time,
+ * because waking up from a sleep can take longer than the precision we need.
+ */
+void Emulator::waitUntil(chrono::steady_clock::time_point deadline)
+{
+    chrono::steady_clock::time_point wakeUp = deadline - PACER_SPIN_TIME;
+    if(chrono::steady_clock::now() < wakeUp)
+    {
+        /* The steady clock uses CLOCK_MONOTONIC, so its time points can be used as absolute
+         * sleep times. */
+        chrono::nanoseconds time = chrono::duration_cast<chrono::nanoseconds>(wakeUp.time_since_epoch());
+        timespec wakeUpTime;
+        wakeUpTime.tv_sec = time.count() / 1000000000;
+        wakeUpTime.tv_nsec = time.count() % 1000000000;
+
+        /* Restart the sleep if it is interrupted by a signal. */
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTime, nullptr) == EINTR);
+    }
+
+    while(chrono::steady_clock::now() < deadline);
+}
+
+
+/**
+ * Sets the speed multiplier, 1 runs at the speed of the Game Boy and 0 runs as fast as possible.
+ */
+void Emulator::setSpeed(double speed)
+{
+    this->options.speed = max(0.0, speed);
+}
+
+
+double Emulator::getSpeed() const
+{
+    return this->options.speed;
+}
+
+
+/**
+ * Sets the number of frames that are not rendered after every rendered frame, this does not
+ * change the timing of the game.
+ */
+void Emulator::setFrameSkip(u32 frames)
+{
+    this->options.frameSkip = frames;
+    if(this->graphicsController != nullptr)
+        this->graphicsController->setFrameSkip(frames);
+}
+
+
+/**
+ * Runs the emulator as fast as possible without a window or input.
+ */
+void Emulator::runHeadless()
+{
+    while(this->isRunning)
+    {
+        runFrame();
+        recordRewindSnapshot();
+        if(this->options.frameLimit > 0 && framesCompleted >= this->options.frameLimit)
+            this->isRunning = false;
     }
 }
 
 
 void Emulator::runFrame()
 {
-    u8 cpuCycles = 0;
+    u64 frame = this->framesCompleted;
+    while(this->framesCompleted == frame)
+    {
+        /* Execute a basic block of CPU instructions. */
+        advance(this->cpu->runBlock());
+    }
+}
+
+
+/**
+ * Takes a rewind snapshot every rewindInterval frames, when rewinding is enabled.
+ */
+void Emulator::recordRewindSnapshot()
+{
+    if(this->rewindBuffer == nullptr)
+        return;
+
+    if(this->framesCompleted % max<u32>(1, this->options.rewindInterval) == 0)
+        this->rewindBuffer->record(this->saveState());
+}
+
+
+/**
+ * Updates the rest of the system with the cycles that the CPU executed.
+ */
+void Emulator::advance(u8 cpuCycles)
+{
+    this->timer->update(cpuCycles);
+
+    /* Update the screen with the same amount of cycles. */
+    this->graphicsController->update(cpuCycles);
 
-    while(cyclesCompleted < INSTRUCTIONS_PER_FRAME)
+    this->totalCycles += cpuCycles;
+    this->cyclesCompleted += cpuCycles;
+    if(this->cyclesCompleted >= INSTRUCTIONS_PER_FRAME)
     {
-        /* CPU step. */
-        cpuCycles = this->cpu->step();
-        cyclesCompleted += cpuCycles;
+        this->cyclesCompleted -= INSTRUCTIONS_PER_FRAME;
+        this->framesCompleted++;
+    }
+}
+
 
-        this->timer->update(cpuCycles);
+/**
+ * Starts up the emulator, if that did not happen yet, and loads a cartridge.
+ */
+void Emulator::loadCartridge(string cartridgePath)
+{
+    if(this->cpu == nullptr)
+        this->startUp();
 
-        /* Update the screen with the same amount of cycles. */
-        this->graphicsController->update(cpuCycles);
+    this->mmu->loadRom(cartridgePath);
+}
+
+
+u64 Emulator::runFrames(u64 frames)
+{
+    assert(this->cpu != nullptr);
+
+    u64 startCycles = this->totalCycles;
+    for(u64 i = 0; i < frames; i++)
+    {
+        runFrame();
+        recordRewindSnapshot();
+    }
+
+    return this->totalCycles - startCycles;
+}
+
+
+/**
+ * Runs whole blocks of instructions until at least the given number of cycles have passed.
+ */
+u64 Emulator::runCycles(u64 cycles)
+{
+    assert(this->cpu != nullptr);
+
+    u64 startCycles = this->totalCycles;
+    while(this->totalCycles - startCycles < cycles)
+        advance(this->cpu->runBlock());
+
+    return this->totalCycles - startCycles;
+}
+
+
+/**
+ * Runs single instructions until the predicate returns true, or until more than maxCycles cycles
+ * have passed when maxCycles is not 0. Returns true if the predicate was met.
+ */
+bool Emulator::runUntil(function<bool(Emulator&)> predicate, u64 maxCycles)
+{
+    assert(this->cpu != nullptr);
+
+    u64 startCycles = this->totalCycles;
+    while(!predicate(*this))
+    {
+        if(maxCycles > 0 && this->totalCycles - startCycles >= maxCycles)
+            return false;
+
+        advance(this->cpu->step());
     }
 
-    /* Input processing. */
-    this->joypad->processInput();
-    this->isRunning = !this->joypad->getButtonQuit();
+    return true;
+}
+
+
+u16 Emulator::readRegister(regID_t id)
+{
+    return this->cpu->readRegister(id);
+}
+
+
+u8 Emulator::readMemory(u16 address)
+{
+    return this->mmu->read(address);
+}
+
+
+CpuState Emulator::getCpuState() const
+{
+    return this->cpu->getState();
+}
+
+
+const vector<u8>& Emulator::getSerialOutput() const
+{
+    return this->mmu->getSerialOutput();
+}
+
+
+/**
+ * Returns the last rendered frame in ABGR8888 format.
+ */
+const u8* Emulator::getFramebuffer() const
+{
+    return this->graphicsController->getFramebuffer();
+}
+
+
+u64 Emulator::getFramesCompleted() const
+{
+    return this->framesCompleted;
+}
+
+
+u64 Emulator::getCyclesCompleted() const
+{
+    return this->totalCycles;
+}
+
+
+/**
+ * Creates a save state. It starts with a magic number and the format version, followed by the
+ * state of the emulator and of every subsystem.
+ */
+vector<u8> Emulator::saveState()
+{
+    assert(this->cpu != nullptr);
+
+    vector<u8> buffer;
+    buffer.reserve(this->lastStateSize);
+
+    StateWriter state(buffer);
+    state.write(SAVE_STATE_MAGIC);
+    state.write(SAVE_STATE_VERSION);
+    state.write(this->cyclesCompleted);
+    state.write(this->framesCompleted);
+    state.write(this->totalCycles);
+
+    this->cpu->saveState(state);
+    this->mmu->saveState(state);
+    this->graphicsController->saveState(state);
+    this->timer->saveState(state);
+    this->interruptController->saveState(state);
+    this->joypad->saveState(state);
+
+    this->lastStateSize = buffer.size();
+    return buffer;
+}
+
+
+/**
+ * Restores a save state that was created by saveState.
+ */
+void Emulator::loadState(const vector<u8>& buffer)
+{
+    assert(this->cpu != nullptr);
+
+    StateReader state(buffer);
+    if(state.read<u32>() != SAVE_STATE_MAGIC)
+        throw std::runtime_error("Data is not a save state");
+    if(state.read<u32>() != SAVE_STATE_VERSION)
+        throw std::runtime_error("Save state version is not supported");
+
+    /* A state that turns out to be invalid halfway, for example because it belongs to another
+     * ROM, is rolled back so the emulator is not left half restored. */
+    vector<u8> backup = this->saveState();
+    try
+    {
+        this->cyclesCompleted = state.read<u64>();
+        this->framesCompleted = state.read<u64>();
+        this->totalCycles = state.read<u64>();
+
+        this->cpu->loadState(state);
+        this->mmu->loadState(state);
+        this->graphicsController->loadState(state);
+        this->timer->loadState(state);
+        this->interruptController->loadState(state);
+        this->joypad->loadState(state);
+        this->mmu->updateMemoryMap();
+
+        if(!state.atEnd())
+            throw std::runtime_error("Save state has trailing data");
+    }
+    catch(...)
+    {
+        this->loadState(backup);
+        throw;
+    }
+}
+
+
+/**
+ * Loads the newest rewind snapshot and removes it from the history, so the next call steps further
+ * back.
+ */
+bool Emulator::rewind()
+{
+    assert(this->cpu != nullptr);
+
+    vector<u8> state;
+    if(this->rewindBuffer == nullptr || !this->rewindBuffer->pop(state))
+        return false;
+
+    this->loadState(state);
+    return true;
+}
+
+
+const RewindBuffer* Emulator::getRewindBuffer() const
+{
+    return this->rewindBuffer.get();
+}
+
+
+/**
+ * Creates a copy of the emulator without copying the contents of its memory. The RAM of the Mmu,
+ * the cartridge and the video RAM are shared copy-on-write, which costs one pointer copy per
+ * 256 byte page. A page is only copied by the emulator that writes to it first. The framebuffer
+ * is shared as well, with a window the current frame is copied. The fork runs headless, both
+ * emulators may run on different threads afterwards.
+ */
+unique_ptr<Emulator> Emulator::fork()
+{
+    assert(this->cpu != nullptr);
+
+    EmulatorOptions forkOptions = this->options;
+    forkOptions.headless = true;
+
+    unique_ptr<Emulator> child(new Emulator(forkOptions));
+    child->isRunning = true;
+    child->cyclesCompleted = this->cyclesCompleted;
+    child->framesCompleted = this->framesCompleted;
+    child->totalCycles = this->totalCycles;
+    child->lastStateSize = this->lastStateSize;
+
+    child->interruptController = std::make_shared<InterruptController>(*this->interruptController);
+    child->joypad = std::make_shared<Joypad>(*this->joypad, child->interruptController);
+    child->timer = std::make_shared<Timer>(*this->timer, child->interruptController);
+    child->graphicsController = std::make_shared<GraphicsController>(*this->graphicsController,
+        child->interruptController);
+    child->mmu = std::make_shared<Mmu>(*this->mmu, child->graphicsController,
+        child->interruptController, child->timer, child->joypad);
+    child->cpu = std::make_shared<Cpu>(*this->cpu, child->mmu, child->interruptController);
+
+    /* The fork starts with its own, empty, rewind history. */
+    if(forkOptions.rewindMemory > 0)
+        child->rewindBuffer = std::make_unique<RewindBuffer>(forkOptions.rewindMemory);
+
+    /* The pages of this emulator are shared now, its next write to a page has to copy it. */
+    this->mmu->updateMemoryMap();
 
-    cyclesCompleted -= INSTRUCTIONS_PER_FRAME;
+    return child;
 }
@@ -0,0 +1,240 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include "polarGB/emulator_pool.h"
+
+
+using namespace std;
+
+
+EmulatorPool::EmulatorPool(unsigned int threadCount, u64 sliceFrames)
+{
+    if(threadCount == 0)
+        threadCount = max(1u, thread::hardware_concurrency());
+
+    this->threadCount = threadCount;
+    this->sliceFrames = max<u64>(1, sliceFrames);
+    this->unfinishedInstances = 0;
+    this->steals = 0;
+    this->workEpoch = 0;
+
+    for(unsigned int i = 0; i < threadCount; i++)
+        this->queues.push_back(make_unique<workQueue_t>());
+}
+
+
+EmulatorPool::~EmulatorPool()
+{
+}
+
+
+/**
+ * Adds a headless emulator that runs the cartridge for the given number of frames. Returns the
+ * index of the instance.
+ */
+size_t EmulatorPool::addInstance(const string& cartridgePath, u64 frames)
+{
+    EmulatorOptions options;
+    options.headless = true;
+
+    instance_t instance = {};
+    instance.emulator = make_unique<Emulator>(options);
+    instance.emulator->loadCartridge(cartridgePath);
+    instance.framesRemaining = frames;
+
+    this->instances.push_back(move(instance));
+    return this->instances.size() - 1;
+}
+
+
+/**
+ * Runs every instance until it has executed its frames. Blocks until all instances are done.
+ */
+void EmulatorPool::run()
+{
+    /* Spread the instances over the queues. */
+    size_t unfinished = 0;
+    for(size_t i = 0; i < this->instances.size(); i++)
+    {
+        if(this->instances[i].framesRemaining == 0)
+            continue;
+
+        this->queues[unfinished % this->threadCount]->instances.push_back(i);
+        unfinished++;
+    }
+    this->unfinishedInstances = unfinished;
+
+    vector<thread> threads;
+    unsigned int workers = min<size_t>(this->threadCount, unfinished);
+    for(unsigned int id = 1; id < workers; id++)
+        threads.emplace_back(&EmulatorPool::worker, this, id);
+
+    /* The calling thread works as well. */
+    if(workers > 0)
+        worker(0);
+
+    for(thread& t : threads)
+        t.join();
+}
+
+
+void EmulatorPool::worker(unsigned int id)
+{
+    size_t index = 0;
+    while(this->unfinishedInstances > 0)
+    {
+        /* Work that is queued after reading the epoch changes it, so it can not be missed while
+         * this thread goes to sleep. */
+        u64 epoch = 0;
+        {
+            lock_guard<mutex> lock(this->idleMutex);
+            epoch = this->workEpoch;
+        }
+
+        if(!popInstance(id, index) && !stealInstance(id, index))
+        {
+            /* The remaining instances are running on other threads. */
+            unique_lock<mutex> lock(this->idleMutex);
+            this->workAvailable.wait(lock, [this, epoch]
+                { return this->workEpoch != epoch || this->unfinishedInstances == 0; });
+            continue;
+        }
+
+        runSlice(index);
+
+        if(this->instances[index].framesRemaining > 0)
+        {
+            {
+                lock_guard<mutex> lock(this->queues[id]->mutex);
+                this->queues[id]->instances.push_back(index);
+            }
+            notifyWorkers(false);
+        }
+        else if(--this->unfinishedInstances == 0)
+            notifyWorkers(true);
+    }
+}
+
+
+/**
+ * Wakes up idle workers after a slice was queued, or all of them when every instance is done.
+ */
+void EmulatorPool::notifyWorkers(bool all)
+{
+    {
+        lock_guard<mutex> lock(this->idleMutex);
+        this->workEpoch++;
+    }
+
+    if(all)
+        this->workAvailable.notify_all();
+    else
+        this->workAvailable.notify_one();
+}
+
+
+/**
+ * Takes the most recently queued instance from the own queue, its state is most likely still in
+ * the cache of this core.
+ */
+bool EmulatorPool::popInstance(unsigned int id, size_t& index)
+{
+    workQueue_t* queue = this->queues[id].get();
+    lock_guard<mutex> lock(queue->mutex);
+    if(queue->instances.empty())
+        return false;
+
+    index = queue->instances.back();
+    queue->instances.pop_back();
+    return true;
+}
+
+
+/**
+ * Takes the oldest instance from the queue of another thread.
+ */
+bool EmulatorPool::stealInstance(unsigned int id, size_t& index)
+{
+    for(unsigned int i = 1; i < this->threadCount; i++)
+    {
+        workQueue_t* queue = this->queues[(id + i) % this->threadCount].get();
+        lock_guard<mutex> lock(queue->mutex);
+        if(queue->instances.empty())
+            continue;
+
+        index = queue->instances.front();
+        queue->instances.pop_front();
+        this->steals++;
+        return true;
+    }
+
+    return false;
+}
+
+
+void EmulatorPool::runSlice(size_t index)
+{
+    instance_t& instance = this->instances[index];
+    u64 frames = min(this->sliceFrames, instance.framesRemaining);
+
+    chrono::time_point<chrono::steady_clock> start = chrono::steady_clock::now();
+    u64 cycles = instance.emulator->runFrames(frames);
+    chrono::duration<double> elapsedTime = chrono::steady_clock::now() - start;
+
+    instance.framesRemaining -= frames;
+    instance.stats.frames += frames;
+    instance.stats.cycles += cycles;
+    instance.stats.slices++;
+    instance.stats.runTime += elapsedTime.count();
+}
+
+
+size_t EmulatorPool::getInstanceCount() const
+{
+    return this->instances.size();
+}
+
+
+unsigned int EmulatorPool::getThreadCount() const
+{
+    return this->threadCount;
+}
+
+
+Emulator& EmulatorPool::getInstance(size_t index)
+{
+    return *this->instances.at(index).emulator;
+}
+
+
+emulatorStats_t EmulatorPool::getStats(size_t index) const
+{
+    return this->instances.at(index).stats;
+}
+
+
+/**
+ * Returns how many slices were taken from the queue of another thread.
+ */
+u64 EmulatorPool::getSteals() const
+{
+    return this->steals;
+}
@@ -15,17 +15,42 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <stdexcept>
+#include <thread>
 #include <fmt/format.h>
 #include "polarGB/graphics_controller.h"
 
 
-const u16 TILE_DATA_AREA_1 = 0x800;
+const u16 TILE_DATA_AREA_1 = 0x9000 - 0x8000;    /* Tile 0 of the signed 0x8800-0x97ff area */
 const u16 TILE_DATA_AREA_2 = 0;
 const u16 TILE_MAP_AREA_1 = 0x9800 - 0x8000;
 const u16 TILE_MAP_AREA_2 = 0x9c00 - 0x8000;
 
 
+/**
+ * Spreads the bits of a tile bit plane over the bytes of a word, the leftmost pixel (bit 7) ends
+ * up in the lowest byte. Combining the spread low and high planes gives the shades of 8 pixels.
+ */
+constexpr std::array<u64, 256> makeBitPlaneTable()
+{
+    std::array<u64, 256> table = {};
+    for(int bits = 0; bits < 256; bits++)
+    {
+        for(int pixel = 0; pixel < 8; pixel++)
+        {
+            if(bits & (0x80 >> pixel))
+                table[bits] |= (u64)1 << (8 * pixel);
+        }
+    }
+    return table;
+}
+
+static constexpr std::array<u64, 256> BIT_PLANE_TABLE = makeBitPlaneTable();
+
+
 GraphicsController::GraphicsController(std::shared_ptr<InterruptController> ic, bool noWindow)
 {
     assert(ic != nullptr);
@@ -45,13 +70,21 @@ GraphicsController::GraphicsController(std::shared_ptr<InterruptController> ic,
     this->WX = 0;
 
     /* Memory */
-    this->vram.size = 0x2000;
-    this->vram.mem = new u8[vram.size]();
+    this->vram = CowMemory(0x2000);
+    this->tileCache = std::make_shared<tileCache_t>();
+    this->dirtyTiles.set();
     this->oam = {};
+    this->framebuffer = std::make_shared<framebuffer_t>();
 
     this->mode = 2;
     this->modeCycles = 0;
+    this->objectsOnCurrentScanline = {};
+    this->objectCount = 0;
     this->noWindow = noWindow;
+    this->presentFrames = true;
+    this->frameSkip = 0;
+    this->framesUntilRender = 0;
+    this->skipFrame = false;
     this->display = nullptr;
     this->interruptController = ic;
 
@@ -69,6 +102,55 @@ GraphicsController::GraphicsController(std::shared_ptr<InterruptController> ic,
 }
 
 
+/**
+ * Forks a graphics controller. The video RAM and the framebuffer are shared with the original
+ * until they are written, the fork never opens a window. A frame of a window is copied since it
+ * belongs to the display.
+ */
+GraphicsController::GraphicsController(const GraphicsController& other,
+    std::shared_ptr<InterruptController> ic)
+{
+    assert(ic != nullptr);
+
+    this->LCDC = other.LCDC;
+    this->STAT = other.STAT;
+    this->SCY = other.SCY;
+    this->SCX = other.SCX;
+    this->LY = other.LY;
+    this->LYC = other.LYC;
+    this->DMA = other.DMA;
+    this->BGP = other.BGP;
+    this->OBP0 = other.OBP0;
+    this->OBP1 = other.OBP1;
+    this->WY = other.WY;
+    this->WX = other.WX;
+
+    this->vram = other.vram;
+    this->tileCache = other.tileCache;
+    this->dirtyTiles = other.dirtyTiles;
+    this->oam = other.oam;
+    if(other.display != nullptr)
+    {
+        this->framebuffer = std::make_shared<framebuffer_t>();
+        std::copy_n(other.getFramebuffer(), sizeof(framebuffer_t), this->framebuffer->data());
+    }
+    else
+        this->framebuffer = other.framebuffer;
+
+    this->mode = other.mode;
+    this->modeCycles = other.modeCycles;
+    this->objectsOnCurrentScanline = other.objectsOnCurrentScanline;
+    this->objectCount = other.objectCount;
+    this->noWindow = true;
+    this->presentFrames = other.presentFrames;
+    this->frameSkip = other.frameSkip;
+    this->framesUntilRender = other.framesUntilRender;
+    this->skipFrame = other.skipFrame;
+    this->display = nullptr;
+    this->interruptController = ic;
+}
+
+
 GraphicsController::~GraphicsController()
 {
 }
@@ -76,11 +158,9 @@ GraphicsController::~GraphicsController()
 
 void GraphicsController::shutDown()
 {
-    delete[] vram.mem;
-    vram.mem = nullptr;
-    vram.size = 0;
+    vram.clear();
 
-    if(noWindow == false)
+    if(display != nullptr)
     {
         display->shutDown();
         delete display;
@@ -100,6 +180,26 @@ void GraphicsController::update(u8 cycles)
 {
     this->modeCycles += cycles;
 
+    /* The cycles can span multiple modes when the CPU executes a block of instructions. */
+    bool modeFinished = false;
+    do
+    {
+        modeFinished = updateMode();
+
+        /* Update the match flag in the STAT register. */
+        updateMatchFlag();
+    } while(modeFinished);
+}
+
+
+/**
+ * Finishes the current mode, or the current line during vertical blanking, when enough cycles
+ * have passed. Returns true if the mode or line was finished.
+ */
+bool GraphicsController::updateMode()
+{
+    bool finished = false;
+
     switch(this->mode)
     {
         /* Horizontal blanking. */
@@ -107,13 +207,15 @@ void GraphicsController::update(u8 cycles)
             if(modeCycles >= 51)
             {
                 modeCycles -= 51;
+                finished = true;
                 LY++;
 
                 /* Check if we enter V-Blank or go to mode 2. */
                 if(LY == 144)
                 {
                     setCurrentMode(1);
-                    this->display->drawFrame();
+                    if(this->display != nullptr && this->presentFrames && !this->skipFrame)
+                        this->display->drawFrame();
                     interruptController->requestInterrupt(int_vblank);
 
                     if(STAT & 0x10)
@@ -134,6 +236,7 @@ void GraphicsController::update(u8 cycles)
             if(modeCycles >= 114)
             {
                 modeCycles -= 114;
+                finished = true;
                 LY++;
 
                 if(LY > 153)
@@ -142,6 +245,11 @@ void GraphicsController::update(u8 cycles)
                     LY = 0;
                     if(STAT & 0x20)
                         interruptController->requestInterrupt(int_stat);
+
+                    /* Decide if the new frame is rendered or skipped. */
+                    this->skipFrame = this->framesUntilRender > 0;
+                    this->framesUntilRender = this->skipFrame ? this->framesUntilRender - 1
+                                                              : this->frameSkip;
                 }
 
             }
@@ -152,7 +260,11 @@ void GraphicsController::update(u8 cycles)
             if(modeCycles >= 20)
             {
                 modeCycles -= 20;
-                searchForObjectsOnCurrentScanline();
+                finished = true;
+                if(this->skipFrame)
+                    this->objectCount = 0;
+                else
+                    searchForObjectsOnCurrentScanline();
                 setCurrentMode(3);
             }
             break;
@@ -162,8 +274,10 @@ void GraphicsController::update(u8 cycles)
             if(modeCycles >= 43)
             {
                 modeCycles -= 43;
+                finished = true;
                 setCurrentMode(0);
-                processScanline();
+                if(!this->skipFrame)
+                    processScanline();
 
                 if(STAT & 0x8)
                     interruptController->requestInterrupt(int_stat);
@@ -171,185 +285,367 @@ void GraphicsController::update(u8 cycles)
             break;
     }
 
-    /* Update the match flag in the STAT register. */
-    updateMatchFlag();
+    return finished;
+}
+
+
+void GraphicsController::processScanline()
+{
+    bool LCDEnabled = (this->LCDC & 0x80) == 0x80;
+
+    /* A disabled LCD or background shows shade 0 of the background palette. */
+    std::array<u8, SCREEN_WIDTH> line;
+    if(LCDEnabled && (this->LCDC & 0x1))
+        processBackgroundLine(line);
+    else
+        line.fill(PALETTE_BGP);
+
+    if(LCDEnabled && (this->LCDC & 0x2) && this->objectCount > 0)
+        processObjectLine(line);
+
+    /* Map the whole line through the palettes at once. */
+    assert(this->LY < SCREEN_HEIGHT);
+    u8* pixels = getWritableFramebuffer() + this->LY * SCREEN_WIDTH * 4;
+    linePalette_t palette = makeLinePalette(this->BGP, this->OBP0, this->OBP1);
+    expandScanline(line.data(), palette, pixels, SCREEN_WIDTH);
 }
 
 
 /**
- * Transforms a pixel coordinate to a tile coordinate and then calculate the tile index in memory.
- * The transformation will make sure that the pixel can be divided by 8 bits by removing bits 0-2.
+ * Returns the frame to render into. With a window this is a buffer of the display, which the
+ * main thread presents without copying it first.
  */
-constexpr int getTileIdx(u8 x, u8 y)
+u8* GraphicsController::getWritableFramebuffer()
 {
-    return ((x & 0xf8) / 0x8) + 32 * ((y & 0xf8) / 0x8);
+    if(this->display != nullptr)
+        return this->display->getWritableFrame();
+
+    /* The framebuffer of a fork is copied when it draws its first scanline. Once it is no longer
+     * shared, the reads of the emulator that released it have to happen before our writes. */
+    if(this->framebuffer.use_count() > 1)
+        this->framebuffer = std::make_shared<framebuffer_t>(*this->framebuffer);
+    else
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+    return this->framebuffer->data();
 }
 
 
-void GraphicsController::processScanline()
+/**
+ * Fetches a row of the tile at a tile map position and decodes it into the shades of its 8
+ * pixels, the leftmost pixel in the lowest byte.
+ */
+u64 GraphicsController::fetchTileRow(u16 tileMapAddr, u8 tileX, u8 y)
 {
-    bool LCDEnabled = (this->LCDC & 0x80) == 0x80;
+    u8 tileIndex = this->vramRead(tileMapAddr + (y / 8) * 32 + (tileX & 0x1f));
 
-    if(LCDEnabled)
-    {
-        bool backgroundAndWindowEnabled = this->LCDC & 0x1;
-        for(int i = 0; i < SCREEN_WIDTH; i++)
-        {
-            if(backgroundAndWindowEnabled)
-                processBackgroundPixel(i);
-            else
-                this->display->updatePixel(i, this->LY, 0xff, 0xff, 0xff, 0xff);
+    /* The 0x8800 area indexes tiles with a signed number from 0x9000. */
+    u16 addr = (this->LCDC & 0x10) ? TILE_DATA_AREA_2 + tileIndex * 16
+                                   : TILE_DATA_AREA_1 + (i8)tileIndex * 16;
 
-            processObjectPixel(i);
-        }
+    return (*this->tileCache)[addr / 2 + y % 8];
+}
 
-    }
+
+/**
+ * Decodes the tile row that contains a tile data address into the tile cache.
+ */
+void GraphicsController::decodeTileRow(u16 address)
+{
+    assert(address < TILE_COUNT * 16);
+
+    /* The cache of a fork is copied when it first changes. */
+    if(this->tileCache.use_count() > 1)
+        this->tileCache = std::make_shared<tileCache_t>(*this->tileCache);
     else
-    {
-        for(auto i = 0; i < SCREEN_WIDTH; i++)
-            this->display->updatePixel(i, this->LY, 0xff, 0xff, 0xff, 0xff);
-    }
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+    u16 rowAddress = address & ~0x1;
+    u8 low = this->vram.read(rowAddress);
+    u8 high = this->vram.read(rowAddress + 1);
+    (*this->tileCache)[rowAddress / 2] = BIT_PLANE_TABLE[low] | (BIT_PLANE_TABLE[high] << 1);
+    this->dirtyTiles.set(address / 16);
+}
+
+
+u64 GraphicsController::getTileRow(u16 tile, u8 row) const
+{
+    assert(tile < TILE_COUNT);
+    assert(row < 8);
+
+    return (*this->tileCache)[tile * 8 + row];
+}
+
+
+const std::bitset<TILE_COUNT>& GraphicsController::getDirtyTiles() const
+{
+    return this->dirtyTiles;
+}
+
+
+void GraphicsController::clearDirtyTiles()
+{
+    this->dirtyTiles.reset();
 }
 
 
 /**
- * Process the background or windows pixel. The pixel coordinate is (x, LY) where x is given as
- * an argument and the y-pos is the current scanline.
+ * Renders the shades of the background and the window on the current scanline, the background
+ * palette is 0 so the shades are scanline pixels. Every tile row is fetched and decoded once,
+ * which gives 8 pixels at a time.
  */
-void GraphicsController::processBackgroundPixel(u8 x)
+void GraphicsController::processBackgroundLine(std::array<u8, SCREEN_WIDTH>& line)
 {
     assert(LCDC & 0x1);
     assert((LCDC & 0x80) == 0x80);
 
-    u16 backgroundTileMapAddr = TILE_MAP_AREA_1;
-    if(this->LCDC & 0x8)
-        backgroundTileMapAddr = TILE_MAP_AREA_2;
-
-    u16 windowTileMapAddr = TILE_MAP_AREA_1;
-    if(this->LCDC & 0x40)
-        windowTileMapAddr = TILE_MAP_AREA_2;
+    /* Background, the line starts SCX % 8 pixels into the first tile. */
+    u16 backgroundTileMapAddr = (this->LCDC & 0x8) ? TILE_MAP_AREA_2 : TILE_MAP_AREA_1;
+    u8 y = this->LY + this->SCY;
+    u8 fineX = this->SCX % 8;
 
-    u16 tileDataAddr = TILE_DATA_AREA_1;
-    if(this->LCDC & 0x10)
-        tileDataAddr = TILE_DATA_AREA_2;
+    std::array<u8, SCREEN_WIDTH + 8> background;
+    for(int tile = 0; tile <= SCREEN_WIDTH / 8; tile++)
+    {
+        u64 pixels = fetchTileRow(backgroundTileMapAddr, this->SCX / 8 + tile, y);
+        for(int i = 0; i < 8; i++)
+            background[tile * 8 + i] = pixels >> (8 * i);
+    }
+    std::copy(background.begin() + fineX, background.begin() + fineX + SCREEN_WIDTH, line.begin());
 
-    int xPixel, yPixel, tileDataIndex;
+    /* Window, it starts at screen position WX - 7 and is drawn over the background. */
     bool windowEnabled = this->LCDC & 0x20;
+    if(!windowEnabled || this->LY < this->WY || this->WX >= SCREEN_WIDTH + 7)
+        return;
 
-    if(windowEnabled && x >= (this->WX - 6) && this->LY >= this->WY)
+    u16 windowTileMapAddr = (this->LCDC & 0x40) ? TILE_MAP_AREA_2 : TILE_MAP_AREA_1;
+    int windowX = this->WX - 7;
+    u8 windowY = this->LY - this->WY;
+    for(int tile = 0; windowX + tile * 8 < SCREEN_WIDTH; tile++)
     {
-        /* Window */
+        u64 pixels = fetchTileRow(windowTileMapAddr, tile, windowY);
+        for(int i = 0; i < 8; i++)
+        {
+            int x = windowX + tile * 8 + i;
+            if(x >= 0 && x < SCREEN_WIDTH)
+                line[x] = pixels >> (8 * i);
+        }
+    }
+}
+
+
+/**
+ * Renders the objects on the current scanline into an object line and merges it with the
+ * background. Objects are drawn in priority order and only into pixels that no object covers yet,
+ * colour 0 is transparent. An object pixel with the background priority flag is hidden behind
+ * background shades 1-3.
+ */
+void GraphicsController::processObjectLine(std::array<u8, SCREEN_WIDTH>& line)
+{
+    const u8 xOffset = 8;
+    const u8 yOffset = 16;
+    const u8 behindBackground = 0x80;
+    u8 spriteHeight = (this->LCDC & 0x4) ? 16 : 8;
 
-        /* Get window coordinate. */
-        xPixel = this->WX - x;
-        yPixel = this->WY - this->LY;
+    /* Palette tagged object pixels, 0 where no object covers the pixel. */
+    std::array<u8, SCREEN_WIDTH> objects = {};
 
-        /* Get tile id. */
-        int tileMapIndex = getTileIdx(xPixel, yPixel);
-        tileDataIndex = this->vramRead(windowTileMapAddr + tileMapIndex);
+    for(u8 i = 0; i < this->objectCount; i++)
+    {
+        const SpriteAttributes& objectAttribute = this->objectsOnCurrentScanline[i];
+
+        /* Y flip mirrors the row within the whole object, 8x16 objects use an even and odd tile. */
+        u8 row = this->LY + yOffset - objectAttribute.y;
+        if(objectAttribute.flags & 0x40)
+            row = spriteHeight - 1 - row;
+        u8 tileIndex = objectAttribute.tileIndex;
+        if(spriteHeight == 16)
+            tileIndex = (row < 8) ? (tileIndex & 0xfe) : (tileIndex | 0x1);
+
+        /* A decoded row has a pixel per byte, X flip reverses the bytes. */
+        u64 tileRow = getTileRow(tileIndex, row % 8);
+        if(objectAttribute.flags & 0x20)
+            tileRow = __builtin_bswap64(tileRow);
+
+        u8 tag = (objectAttribute.flags & 0x10) ? PALETTE_OBP1 : PALETTE_OBP0;
+        if(objectAttribute.flags & 0x80)
+            tag |= behindBackground;
+
+        int start = objectAttribute.x - xOffset;
+        for(int column = std::max(0, -start); column < 8 && start + column < SCREEN_WIDTH; column++)
+        {
+            u8 pixelShade = (tileRow >> (8 * column)) & 0x3;
+            u8& pixel = objects[start + column];
+            if(pixelShade != 0 && pixel == 0)
+                pixel = tag | pixelShade;
+        }
     }
-    else
+
+    /* Merge the objects with the background in one pass. */
+    for(int x = 0; x < SCREEN_WIDTH; x++)
     {
-        /* Background */
+        u8 object = objects[x];
+        bool hidden = (object & behindBackground) && (line[x] & 0x3) != 0;
+        if(object != 0 && !hidden)
+            line[x] = object & ~behindBackground;
+    }
+}
 
-        /* Get background coordinate. */
-        xPixel = ((int)SCX + (int)x) % 256;
-        yPixel = ((int)LY + (int)SCY) % 256;
 
-        /* Get tile id. */
-        int tileMapIndex = getTileIdx(xPixel, yPixel);
-        tileDataIndex = this->vramRead(backgroundTileMapAddr + tileMapIndex);
-    }
+/**
+ * Returns the last rendered pixels of the screen in ABGR8888 format.
+ */
+const u8* GraphicsController::getFramebuffer() const
+{
+    if(this->display != nullptr)
+        return this->display->getFrame();
 
-    /* Fetch the pixel shade; */
-    int xBlock = 7 - (xPixel % 8);
-    int yBlock = yPixel % 8;
-    u16 addr = tileDataAddr + (tileDataIndex * 16) + (yBlock * 2);
-    u8 low = this->vramRead(addr);
-    u8 high = this->vramRead(addr + 1);
-    u8 pixelShade = ((low >> xBlock) & 0x1) | (((high >> xBlock) & 0x1) << 1);
+    return this->framebuffer->data();
+}
 
-    u8 color = 0;
-    switch (pixelShade) {
-        case 0:
-            color = 255;
-            break;
-        case 1:
-            color = 170;
-            break;
-        case 2:
-            color = 85;
-            break;
-        case 3:
-            color = 0;
-            break;
-    }
 
-    this->display->updatePixel(x, this->LY, color, color, color, 0xff);
+/**
+ * Enables or disables presenting finished frames on the display. Frames are always rendered into
+ * the framebuffer.
+ */
+void GraphicsController::setFramePresentation(bool enabled)
+{
+    this->presentFrames = enabled;
 }
 
+
 /**
- * Process a pixel in the object layer. This function might not set a pixel if there are no sprites
- * located on the specific screen pixel. The pixel we are processing is (x,LY).
+ * Skips rendering the given number of frames after every rendered frame. A skipped frame keeps
+ * its timing, modes and interrupts, only the OAM scan and the pixels are left out. The
+ * framebuffer keeps the last rendered frame and skipped frames are not presented.
  */
-void GraphicsController::processObjectPixel(u8 x)
+void GraphicsController::setFrameSkip(u32 frames)
 {
+    /* The frames after a rendered frame are skipped, a frame that is being skipped does not
+     * delay the next rendered frame. */
+    this->frameSkip = frames;
+    this->framesUntilRender = this->skipFrame ? std::min(this->framesUntilRender, frames) : frames;
+}
 
-    const u8 xOffset = 8;
-    const u8 spriteWidth = 8;
 
-    for(auto objectAttribute : this->objectsOnCurrentScanline)
+/**
+ * Presents the next frame on the display, called from the main thread while the emulation runs on
+ * another thread. Returns false when no frame was drawn before the timeout, without a window this
+ * only waits for the timeout.
+ */
+bool GraphicsController::presentNextFrame(std::chrono::milliseconds timeout)
+{
+    if(this->display == nullptr)
     {
-        /* Continue searching if x position is too small. */
-        if(objectAttribute.x - xOffset + spriteWidth < x)
-            continue;
+        std::this_thread::sleep_for(timeout);
+        return false;
+    }
 
-        /* Stop searching for the object when they are past the current pixel. (List is sorted on x-axis) */
-        if(objectAttribute.x - xOffset > x)
-            break;
+    return this->display->presentNextFrame(timeout);
+}
 
-        /* Fetch the pixel shade; */
-        int xBlock = 7 - (x % 8);
-        int yBlock = LY % 8;
-        u16 addr = (objectAttribute.tileIndex * 16) + (yBlock * 2);
-        u8 low = this->vramRead(addr);
-        u8 high = this->vramRead(addr + 1);
-        u8 pixelShade = ((low >> xBlock) & 0x1) | (((high >> xBlock) & 0x1) << 1);
-
-        u8 color = 0;
-        switch (pixelShade) {
-            case 0:
-                color = 255;
-                break;
-            case 1:
-                color = 170;
-                break;
-            case 2:
-                color = 85;
-                break;
-            case 3:
-                color = 0;
-                break;
-        }
 
-        this->display->updatePixel(x, this->LY, color, color, color, 0xff);
-    }
+/**
+ * Returns the counters of the display, they are all zero without a window.
+ */
+presentStats_t GraphicsController::getPresentStats() const
+{
+    if(this->display == nullptr)
+        return presentStats_t{};
+
+    return this->display->getPresentStats();
+}
+
+
+/**
+ * Stores the video memory, the registers, the current mode and the frame that is being rendered.
+ */
+void GraphicsController::saveState(StateWriter& state) const
+{
+    this->vram.saveState(state);
+    state.write(this->oam);
+
+    for(u8 reg : {LCDC, STAT, SCY, SCX, LY, LYC, DMA, BGP, OBP0, OBP1, WY, WX})
+        state.write(reg);
+
+    state.write(this->mode);
+    state.write(this->modeCycles);
+
+    state.write(this->objectCount);
+    for(u8 i = 0; i < this->objectCount; i++)
+        state.write(this->objectsOnCurrentScanline[i]);
+
+    state.writeBytes(this->getFramebuffer(), sizeof(framebuffer_t));
+}
+
+
+void GraphicsController::loadState(StateReader& state)
+{
+    this->vram.loadState(state);
+    for(u16 address = 0; address < TILE_COUNT * 16; address += 2)
+        decodeTileRow(address);
+    this->oam = state.read<std::array<SpriteAttributes, 40>>();
+
+    for(u8* reg : {&LCDC, &STAT, &SCY, &SCX, &LY, &LYC, &DMA, &BGP, &OBP0, &OBP1, &WY, &WX})
+        *reg = state.read<u8>();
+
+    this->mode = state.read<u8>();
+    if(this->mode > 3)
+        throw std::runtime_error("Save state has an invalid display mode");
+    this->modeCycles = state.read<u64>();
+    if(this->modeCycles > 114)
+        throw std::runtime_error("Save state has an invalid number of mode cycles");
+
+    /* Only vertical blanking runs past the last line of the screen. */
+    if(this->LY > 153 || (this->LY >= SCREEN_HEIGHT && this->mode != 1))
+        throw std::runtime_error("Save state has an invalid scanline");
+
+    this->objectCount = state.read<u8>();
+    if(this->objectCount > MAX_OBJECTS_PER_LINE)
+        throw std::runtime_error("Save state has too many objects on the scanline");
+    for(u8 i = 0; i < this->objectCount; i++)
+        this->objectsOnCurrentScanline[i] = state.read<SpriteAttributes>();
+
+    if(this->display == nullptr && this->framebuffer.use_count() > 1)
+        this->framebuffer = std::make_shared<framebuffer_t>();
+    state.readBytes(getWritableFramebuffer(), sizeof(framebuffer_t));
 }
 
 
+/**
+ * Finds the first 10 objects in OAM on the current scanline and sorts them on their x
+ * coordinate. Objects with the same x keep their OAM order.
+ */
 void GraphicsController::searchForObjectsOnCurrentScanline()
 {
-    /* Clear objects from previous scanline. */
-    this->objectsOnCurrentScanline.clear();
+    u8 spriteHeight = (this->LCDC & 0x4) ? 16 : 8;
 
+    /* Every object is stored in the next free slot, which only advances if the object is on
+     * the scanline. */
     int offsettedScanline = this->LY + 16;
-    for(auto spriteAttribute = this->oam.begin(); spriteAttribute != this->oam.end(); ++spriteAttribute)
+    u8 count = 0;
+    for(const SpriteAttributes& spriteAttribute : this->oam)
+    {
+        this->objectsOnCurrentScanline[count] = spriteAttribute;
+        count += (unsigned)(offsettedScanline - spriteAttribute.y) < spriteHeight;
+        if(count == MAX_OBJECTS_PER_LINE)
+            break;
+    }
+    this->objectCount = count;
+
+    /* Insertion sort, the list is short and often already sorted. */
+    for(u8 i = 1; i < count; i++)
     {
-        if(spriteAttribute->y <= offsettedScanline && spriteAttribute->y + 8 > offsettedScanline)
-            this->objectsOnCurrentScanline.push_back(*spriteAttribute);
+        SpriteAttributes next = this->objectsOnCurrentScanline[i];
+        u8 j = i;
+        while(j > 0 && compareSpriteAttributesByXCoordinate(next, objectsOnCurrentScanline[j - 1]))
+        {
+            this->objectsOnCurrentScanline[j] = this->objectsOnCurrentScanline[j - 1];
+            j--;
+        }
+        this->objectsOnCurrentScanline[j] = next;
     }
 
-    this->objectsOnCurrentScanline.sort(compareSpriteAttributesByXCoordinate);
 }
 
 
@@ -392,19 +688,30 @@ void GraphicsController::updateMatchFlag()
 
 u8 GraphicsController::vramRead(u16 address)
 {
-    assert(address < vram.size);
-    assert(vram.mem != nullptr);
+    assert(address < vram.size());
 
-    return vram.mem[address];
+    return vram.read(address);
 }
 
 
 void GraphicsController::vramWrite(u16 address, u8 data)
 {
-    assert(address < vram.size);
-    assert(vram.mem != nullptr);
+    assert(address < vram.size());
+
+    vram.write(address, data);
+    if(address < TILE_COUNT * 16)
+        decodeTileRow(address);
+}
+
 
-    vram.mem[address] = data;
+/**
+ * Returns the 256 byte page of video RAM that contains the address, the Mmu reads from it
+ * directly. Writes have to go through vramWrite, which may replace the page when it is shared
+ * with a fork.
+ */
+const u8* GraphicsController::getVramPage(u16 address) const
+{
+    return this->vram.getPage(address);
 }
 
 
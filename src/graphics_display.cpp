@@ -17,22 +17,34 @@
 
 #include <fmt/format.h>
 #include <cassert>
+#include <chrono>
 #include <cstring>
 #include "polarGB/graphics_display.h"
 
 
-GraphicsDisplay::GraphicsDisplay()
+GraphicsDisplay::GraphicsDisplay() : frames(SCREEN_WIDTH * SCREEN_HEIGHT * 4)
 {
+    this->window = nullptr;
+    this->renderer = nullptr;
+    this->texture = nullptr;
+    this->texturePixels = NULL;
+    this->pitch = 0;
+    this->currentFrame = this->frames.getWriteBuffer();
+    this->framesPresented = 0;
+    this->totalLatency = 0;
+    this->maxLatency = 0;
 }
 
 
 GraphicsDisplay::~GraphicsDisplay()
 {
+    if(this->window != nullptr)
+        this->shutDown();
 }
 
 
 /**
- * Starts up a SDL2 and create a window.
+ * Starts up a SDL2 and creates a window with its renderer, on the main thread.
  * Return value:
  *  - 0 on success.
  *  - 1 on error.
@@ -63,46 +75,139 @@ int GraphicsDisplay::startUp()
         return 1;
     }
 
-    this->renderer = SDL_CreateRenderer(this->window, -1, SDL_RENDERER_ACCELERATED);
-    if(renderer == NULL)
+    if(createRenderer() == false)
     {
-        fmt::print(stderr, "Could not create renderer, reason: {}\n", SDL_GetError());
         SDL_DestroyWindow(window);
         window = nullptr;
         SDL_Quit();
+        return 1;
+    }
+
+    return 0;
+}
+
+
+void GraphicsDisplay::shutDown()
+{
+    destroyRenderer();
+
+    SDL_DestroyWindow(this->window);
+    this->window = nullptr;
+    SDL_Quit();
+}
+
+
+/**
+ * Returns the frame to render into, the pixels are stored in ABGR8888 format. After drawFrame this
+ * is a different buffer that holds an older frame.
+ */
+u8* GraphicsDisplay::getWritableFrame()
+{
+    this->currentFrame = this->frames.getWriteBuffer();
+    return this->currentFrame;
+}
+
+
+/**
+ * Returns the frame that is being rendered, or the last drawn frame if rendering did not continue
+ * yet. The main thread only reads a drawn frame, so it can still be read here.
+ */
+const u8* GraphicsDisplay::getFrame() const
+{
+    return this->currentFrame;
+}
+
+
+/**
+ * Hands the rendered frame over to the main thread. This never waits for the main thread, if it
+ * is still busy with an older frame the newest frame replaces the one it has not taken yet.
+ */
+void GraphicsDisplay::drawFrame()
+{
+    this->frames.publish();
+    this->frameReady.notify_one();
+}
+
+
+presentStats_t GraphicsDisplay::getPresentStats() const
+{
+    presentStats_t stats;
+    stats.framesPresented = this->framesPresented.load();
+    stats.framesDropped = this->frames.getDroppedFrames();
+    stats.averageLatency = stats.framesPresented > 0 ?
+        this->totalLatency.load() * 1e-9 / stats.framesPresented : 0.0;
+    stats.maxLatency = this->maxLatency.load() * 1e-9;
+    return stats;
+}
+
+
+/**
+ * Waits up to the timeout for a frame published by drawFrame and presents it. Returns false if no
+ * new frame was drawn in time.
+ */
+bool GraphicsDisplay::presentNextFrame(std::chrono::milliseconds timeout)
+{
+    /* drawFrame notifies without the lock, a missed notification only delays the frame until
+     * the timeout. */
+    {
+        std::unique_lock<std::mutex> lock(this->frameMutex);
+        this->frameReady.wait_for(lock, timeout, [this] { return this->frames.hasNewFrame(); });
+    }
+
+    if(this->frames.consume() == false)
+        return false;
+
+    presentFrame(this->frames.getReadBuffer());
+
+    auto latency = std::chrono::steady_clock::now() - this->frames.getReadPublishTime();
+    u64 nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+    this->totalLatency += nanoseconds;
+    if(nanoseconds > this->maxLatency)
+        this->maxLatency = nanoseconds;
+    this->framesPresented++;
+
+    return true;
+}
+
+
+/**
+ * Creates the renderer and the texture of the window.
+ */
+bool GraphicsDisplay::createRenderer()
+{
+    this->renderer = SDL_CreateRenderer(this->window, -1, SDL_RENDERER_ACCELERATED);
+    if(renderer == NULL)
+    {
+        fmt::print(stderr, "Could not create renderer, reason: {}\n", SDL_GetError());
+        return false;
     }
 
     SDL_SetRenderDrawColor(this->renderer, 0xff, 0xff, 0xff, 0xff);
 
     this->texture = SDL_CreateTexture(this->renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STREAMING, this->width, this->height);
 
-    pixels = new u8[width * height * 4];
-    std::memset(pixels, 0x0, width * height * 4);
     texturePixels = NULL;
     pitch = 0;
 
-    return 0;
+    return true;
 }
 
 
-void GraphicsDisplay::shutDown()
+void GraphicsDisplay::destroyRenderer()
 {
-    delete[] pixels;
-    pixels = nullptr;
+    SDL_DestroyTexture(this->texture);
+    this->texture = nullptr;
 
     SDL_DestroyRenderer(this->renderer);
     this->renderer = nullptr;
-
-    SDL_DestroyWindow(this->window);
-    this->window = nullptr;
-    SDL_Quit();
 }
 
 
-void GraphicsDisplay::drawFrame()
+void GraphicsDisplay::presentFrame(const u8* pixels)
 {
-    lockTexture();
-    copyPixelsToTexture();
+    if(lockTexture() == false)
+        return;
+    copyPixelsToTexture(pixels);
     unlockTexture();
 
     /* Clear the screen. */
@@ -116,22 +221,6 @@ void GraphicsDisplay::drawFrame()
 }
 
 
-/**
- * Pixel data is stored in ABGR8888 format.
- */
-void GraphicsDisplay::updatePixel(u8 x, u8 y, u8 r, u8 g, u8 b, u8 a)
-{
-    assert(x < this->width);
-    assert(y < this->height);
-
-    int index = (y * 4 * this->width) + (4 * x);
-    this->pixels[index] = r;
-    this->pixels[index + 1] = g;
-    this->pixels[index + 2] = b;
-    this->pixels[index + 3] = a;
-}
-
-
 bool GraphicsDisplay::lockTexture()
 {
     /* Check if texture is already locked. */
@@ -156,10 +245,20 @@ void GraphicsDisplay::unlockTexture()
 }
 
 
-void GraphicsDisplay::copyPixelsToTexture()
+void GraphicsDisplay::copyPixelsToTexture(const u8* pixels)
 {
     assert(this->texturePixels != NULL);
-    assert(this->pixels != NULL);
+    assert(pixels != NULL);
+
+    /* The rows of the texture can be padded. */
+    int rowSize = this->width * 4;
+    if(this->pitch == rowSize)
+    {
+        std::memcpy(this->texturePixels, pixels, rowSize * this->height);
+        return;
+    }
 
-    std::memcpy(this->texturePixels, this->pixels, this->pitch * this->height);
+    u8* texture = static_cast<u8*>(this->texturePixels);
+    for(int y = 0; y < this->height; y++)
+        std::memcpy(texture + y * this->pitch, pixels + y * rowSize, rowSize);
 }
@@ -167,3 +167,21 @@ void InterruptController::setIE(u8 value)
 {
     this->IE = value & 0x1f;
 }
+
+
+void InterruptController::saveState(StateWriter& state) const
+{
+    state.write(this->IF);
+    state.write(this->IE);
+    state.write(this->IME);
+    state.write(this->delayed_enable);
+}
+
+
+void InterruptController::loadState(StateReader& state)
+{
+    this->IF = state.read<u8>();
+    this->IE = state.read<u8>();
+    this->IME = state.readBool();
+    this->delayed_enable = state.readBool();
+}
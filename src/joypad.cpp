@@ -36,6 +36,7 @@ Joypad::Joypad(std::shared_ptr<InterruptController> interruptController)
     this->interruptController = interruptController;
     this->P1 = 0x3f;
     this->buttonQuit = false;
+    this->buttonRewind = false;
     this->buttonA = false;
     this->buttonB = false;
     this->buttonSelect = false;
@@ -47,6 +48,28 @@ Joypad::Joypad(std::shared_ptr<InterruptController> interruptController)
 }
 
 
+/**
+ * Copies the joypad of a forked emulator, including the buttons that are held down.
+ */
+Joypad::Joypad(const Joypad& other, std::shared_ptr<InterruptController> interruptController)
+{
+    assert(interruptController != nullptr);
+
+    this->interruptController = interruptController;
+    this->P1 = other.P1;
+    this->buttonQuit = other.buttonQuit.load();
+    this->buttonRewind = other.buttonRewind.load();
+    this->buttonA = other.buttonA.load();
+    this->buttonB = other.buttonB.load();
+    this->buttonSelect = other.buttonSelect.load();
+    this->buttonStart = other.buttonStart.load();
+    this->buttonRight = other.buttonRight.load();
+    this->buttonLeft = other.buttonLeft.load();
+    this->buttonUp = other.buttonUp.load();
+    this->buttonDown = other.buttonDown.load();
+}
+
+
 Joypad::~Joypad()
 {
 }
@@ -121,12 +144,21 @@ bool Joypad::getButtonQuit() const
 }
 
 
+bool Joypad::getButtonRewind() const
+{
+    return this->buttonRewind;
+}
+
+
 void Joypad::processKeyDown(SDL_Keycode keysym)
 {
     switch(keysym) {
         case SDLK_ESCAPE:
             this->buttonQuit = true;
             break;
+        case SDLK_BACKSPACE:
+            this->buttonRewind = true;
+            break;
         case SDLK_w:
             this->buttonUp = true;
             break;
@@ -163,6 +195,9 @@ void Joypad::processKeyUp(SDL_Keycode keysym)
         case SDLK_ESCAPE:
             this->buttonQuit = false;
             break;
+        case SDLK_BACKSPACE:
+            this->buttonRewind = false;
+            break;
         case SDLK_w:
             this->buttonUp = false;
             break;
@@ -191,3 +226,18 @@ void Joypad::processKeyUp(SDL_Keycode keysym)
             break;
     }
 }
+
+
+/**
+ * Only the P1 register is stored, the buttons follow the input of the user.
+ */
+void Joypad::saveState(StateWriter& state) const
+{
+    state.write(this->P1);
+}
+
+
+void Joypad::loadState(StateReader& state)
+{
+    this->P1 = state.read<u8>();
+}
@@ -16,6 +16,7 @@
  */
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <boost/program_options.hpp>
@@ -33,6 +34,7 @@ const size_t MINOR_VERSION = 0;
 struct ParsedArguments
 {
     string cartridgePath;
+    EmulatorOptions options;
 };
 
 
@@ -42,7 +44,15 @@ void printHelp()
     fmt::print("Emulates the Game Boy to play FILE.\n\n");
     fmt::print("Options:\n");
     fmt::print("  -h, --help           Display this help information\n");
+    fmt::print("      --frame-skip N   Skip rendering N frames after every rendered frame\n");
+    fmt::print("      --frames N       Stop after N frames\n");
+    fmt::print("      --headless       Run without a window or input as fast as possible\n");
     fmt::print("      --input-file     Input gameboy rom file\n");
+    fmt::print("      --rewind MB      Keep up to MB MiB of rewind history, hold backspace to rewind\n");
+    fmt::print("      --rewind-interval N\n");
+    fmt::print("                       Take a rewind snapshot every N frames, 4 by default\n");
+    fmt::print("      --speed X        Run at X times the normal speed, 0 runs as fast as possible\n");
+    fmt::print("      --stats          Print cache and display statistics on exit\n");
     fmt::print("      --version        Display emulator version information\n");
 
     exit(EXIT_SUCCESS);
@@ -64,7 +74,14 @@ ParsedArguments parseArguments(int argc, char* argv[])
     po::options_description description("Allowed options");
     description.add_options()
         ("help,h", "Display this help information")
+        ("frame-skip", po::value<u32>(), "Skip rendering N frames after every rendered frame")
+        ("frames", po::value<u64>(), "Stop after N frames")
+        ("headless", "Run without a window or input as fast as possible")
         ("input-file", po::value<vector<string>>(), "Input gameboy rom file")
+        ("rewind", po::value<double>(), "Keep up to MB MiB of rewind history")
+        ("rewind-interval", po::value<u32>(), "Take a rewind snapshot every N frames")
+        ("speed", po::value<double>(), "Run at X times the normal speed, 0 runs as fast as possible")
+        ("stats", "Print cache and display statistics on exit")
         ("version", "Display emulator version information");
 
     po::positional_options_description p;
@@ -79,6 +96,33 @@ ParsedArguments parseArguments(int argc, char* argv[])
     else if(vm.count("version"))
         printVersion();
 
+    arguments.options.headless = vm.count("headless") > 0;
+    arguments.options.printStats = vm.count("stats") > 0;
+    if(vm.count("frames"))
+        arguments.options.frameLimit = vm["frames"].as<u64>();
+    if(vm.count("frame-skip"))
+        arguments.options.frameSkip = vm["frame-skip"].as<u32>();
+    if(vm.count("speed"))
+    {
+        arguments.options.speed = vm["speed"].as<double>();
+        if(arguments.options.speed < 0.0)
+            throw std::invalid_argument("the speed multiplier can not be negative");
+    }
+
+    if(vm.count("rewind"))
+    {
+        double megabytes = vm["rewind"].as<double>();
+        if(megabytes < 0.0)
+            throw std::invalid_argument("the rewind memory can not be negative");
+        arguments.options.rewindMemory = megabytes * 1024 * 1024;
+    }
+    if(vm.count("rewind-interval"))
+    {
+        arguments.options.rewindInterval = vm["rewind-interval"].as<u32>();
+        if(arguments.options.rewindInterval == 0)
+            throw std::invalid_argument("the rewind interval has to be at least 1 frame");
+    }
+
     /* Get the input rom file. */
     if(vm.count("input-file"))
     {
@@ -111,7 +155,7 @@ int main(int argc, char* argv[])
     }
 
     /* Start the emulator and load the cartridge. */
-    unique_ptr<Emulator> emu = make_unique<Emulator>();
+    unique_ptr<Emulator> emu = make_unique<Emulator>(arguments.options);
     emu->start(arguments.cartridgePath);
 
     return EXIT_SUCCESS;
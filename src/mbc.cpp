@@ -15,6 +15,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <stdexcept>
 #include "polarGB/mbc.h"
 #include <fmt/format.h>
 
@@ -22,13 +24,25 @@
 using namespace std;
 
 
-MBC::MBC(int romSize, int ramSize)
+MBC::MBC(shared_ptr<const RomImage> romImage, int romSize, int ramSize)
 {
+    /* A ROM file that is smaller than its header claims only provides the banks it contains. */
+    if(romImage->size() < (size_t)romSize)
+    {
+        fmt::print(stderr, "Warning, ROM file is smaller than the ROM size in the cartridge header\n");
+        romSize = romImage->size() - romImage->size() % ROM_BANK_SIZE;
+    }
+
+    this->romImage = romImage;
     this->romSize = romSize;
     this->ramSize = ramSize;
 
-    this->romMem.resize(romSize);
-    this->ramMem.resize(ramSize);
+    this->ramMem = CowMemory(ramSize);
+
+    this->ramEnabled = false;
+    this->ramBankOffset = 0;
+    selectRomBanks(0, 1);
+    selectRamBank(0);
 }
 
 
@@ -38,64 +52,507 @@ MBC::~MBC()
 }
 
 
-void MBC::loadROM(ifstream *f)
-{
-    f->seekg(0, f->beg);
-    u8* data = this->romMem.data();
-    f->read((char *)data, this->romSize);
-}
-
-
 void MBC::clear()
 {
-    this->romMem.clear();
+    this->romImage = nullptr;
     this->romSize = 0;
 
     this->ramMem.clear();
     this->ramSize = 0;
+
+    this->romBanks = {nullptr, nullptr};
+    this->ramBankOffset = 0;
+}
+
+
+MBC* MBC::clone() const
+{
+    return new MBC(*this);
 }
 
 
 u8 MBC::read(u16 address)
 {
     if(address < 0x8000)
+        return this->romBanks[address >> 14][address & (ROM_BANK_SIZE - 1)];
+    else if(address >= 0xa000 && address <= 0xbfff)
+        return this->readRam(address);
+
+    return 0xff;
+}
+
+
+void MBC::write(u16 address, u8 data)
+{
+    if(address < 0x8000)
+        this->writeRegister(address, data);
+    else if(address >= 0xa000 && address <= 0xbfff)
+        this->writeRam(address, data);
+}
+
+
+/**
+ * Returns the ROM bank that is mapped at the given address.
+ */
+int MBC::getRomBank(u16 address) const
+{
+    return this->romBankNumbers[(address >> 14) & 0x1];
+}
+
+
+/**
+ * Returns the start of the ROM bank that is mapped at the given address.
+ */
+const u8* MBC::getRomBankData(u16 address) const
+{
+    return this->romBanks[(address >> 14) & 0x1];
+}
+
+
+/**
+ * Returns the 256 byte RAM page that is mapped at the given address in 0xa000-0xbfff, or nullptr
+ * if the cartridge RAM is not plain memory at the moment. For example when it is disabled or
+ * smaller than a bank.
+ */
+const u8* MBC::getRamPage(u16 address) const
+{
+    if(!this->ramEnabled || !this->isRamMemoryMapped())
+        return nullptr;
+
+    return this->ramMem.getPage(this->ramBankOffset + (address - 0xa000));
+}
+
+
+/**
+ * Returns the RAM page at the given address for writing. A page that is shared with a copy of the
+ * controller returns nullptr, writing it through write() copies the page first.
+ */
+u8* MBC::getWritableRamPage(u16 address)
+{
+    if(getRamPage(address) == nullptr)
+        return nullptr;
+
+    size_t offset = this->ramBankOffset + (address - 0xa000);
+    if(this->ramMem.isPageShared(offset))
+        return nullptr;
+
+    return this->ramMem.getWritablePage(offset);
+}
+
+
+bool MBC::hasRam() const
+{
+    return this->ramMem.size() > 0;
+}
+
+
+/**
+ * Stores the mapped banks and the RAM. The hash of the ROM is stored as well, a state can only be
+ * loaded with the same ROM.
+ */
+void MBC::saveState(StateWriter& state) const
+{
+    state.write(this->romImage->hash());
+    state.write(this->ramEnabled);
+    state.write(this->romBankNumbers);
+    state.write<u32>(this->ramBankOffset);
+    this->ramMem.saveState(state);
+}
+
+
+void MBC::loadState(StateReader& state)
+{
+    if(state.read<u64>() != this->romImage->hash())
+        throw std::runtime_error("Save state was created with a different ROM");
+
+    this->ramEnabled = state.readBool();
+    std::array<int, 2> banks = state.read<std::array<int, 2>>();
+    u32 ramBankOffset = state.read<u32>();
+    this->ramMem.loadState(state);
+
+    /* A ROM without banking stores the banks 0 and 1, which selectRomBanks maps to nothing. */
+    int romBankCount = std::max<int>(2, this->romSize / ROM_BANK_SIZE);
+    for(int bank : banks)
     {
-        return this->romMem[address];
+        if(bank < 0 || bank >= romBankCount)
+            throw std::runtime_error("Save state has an invalid ROM bank");
     }
-    else if(address >= 0xa000 && address <= 0xbfff)
+    if(ramBankOffset % RAM_BANK_SIZE != 0 || (ramBankOffset != 0 && ramBankOffset >= this->ramMem.size()))
+        throw std::runtime_error("Save state has an invalid RAM bank");
+
+    selectRomBanks(banks[0], banks[1]);
+    selectRamBank(ramBankOffset / RAM_BANK_SIZE);
+}
+
+
+/**
+ * Maps ROM banks at 0x0000-0x3fff and 0x4000-0x7fff. Banks beyond the size of the ROM wrap
+ * around, like the unconnected address lines do on the cartridge.
+ */
+void MBC::selectRomBanks(int lowBank, int highBank)
+{
+    int bankCount = this->romSize / ROM_BANK_SIZE;
+    if(bankCount < 2)
     {
-        return this->ramMem[address];
+        this->romBankNumbers = {0, 1};
+        this->romBanks = {nullptr, nullptr};
+        return;
     }
-    else
+
+    this->romBankNumbers = {lowBank % bankCount, highBank % bankCount};
+    this->romBanks[0] = this->romImage->data() + this->romBankNumbers[0] * ROM_BANK_SIZE;
+    this->romBanks[1] = this->romImage->data() + this->romBankNumbers[1] * ROM_BANK_SIZE;
+}
+
+
+void MBC::selectRamBank(int bank)
+{
+    int bankCount = this->ramMem.size() / RAM_BANK_SIZE;
+    if(bankCount == 0)
     {
-        fmt::format("Invalid cartridge read operation at address {:#x}", address);
+        this->ramBankOffset = 0;
+        return;
+    }
+
+    this->ramBankOffset = (bank & (bankCount - 1)) * RAM_BANK_SIZE;
+}
+
+
+/**
+ * Writes to the ROM area program the controller. ROM is read only, without a memory bank
+ * controller these writes have no effect.
+ */
+void MBC::writeRegister(u16, u8)
+{
+}
+
+
+u8 MBC::readRam(u16 address)
+{
+    if(!this->ramEnabled || !this->hasRam())
         return 0xff;
+
+    /* RAM smaller than a bank is mirrored. */
+    size_t offset = (address - 0xa000) % min<size_t>(RAM_BANK_SIZE, this->ramMem.size());
+    return this->ramMem.read(this->ramBankOffset + offset);
+}
+
+
+void MBC::writeRam(u16 address, u8 data)
+{
+    if(!this->ramEnabled || !this->hasRam())
+        return;
+
+    size_t offset = (address - 0xa000) % min<size_t>(RAM_BANK_SIZE, this->ramMem.size());
+    this->ramMem.write(this->ramBankOffset + offset, data);
+}
+
+
+/**
+ * Returns true if the enabled RAM can be accessed as a plain 8 KiB bank.
+ */
+bool MBC::isRamMemoryMapped() const
+{
+    return this->ramMem.size() >= RAM_BANK_SIZE;
+}
+
+
+/**************************************
+ * No memory bank controller
+ *************************************/
+
+NoMBC::NoMBC(shared_ptr<const RomImage> romImage, int romSize, int ramSize) : MBC(romImage, romSize, ramSize)
+{
+    /* Optional RAM is always accessible. */
+    this->ramEnabled = true;
+}
+
+NoMBC::~NoMBC()
+{
+    clear();
+}
+
+
+MBC* NoMBC::clone() const
+{
+    return new NoMBC(*this);
+}
+
+
+/**************************************
+ * MBC1
+ *************************************/
+
+MBC1::MBC1(shared_ptr<const RomImage> romImage, int romSize, int ramSize) : MBC(romImage, romSize, ramSize)
+{
+    this->romBankLow = 1;
+    this->bankHigh = 0;
+    this->advancedMode = false;
+    updateBanks();
+}
+
+MBC1::~MBC1()
+{
+    clear();
+}
+
+
+MBC* MBC1::clone() const
+{
+    return new MBC1(*this);
+}
+
+
+void MBC1::writeRegister(u16 address, u8 data)
+{
+    if(address < 0x2000)       /* RAM enable */
+        this->ramEnabled = (data & 0xf) == 0xa;
+    else if(address < 0x4000)  /* ROM bank, bank 0 selects bank 1 */
+        this->romBankLow = (data & 0x1f) == 0 ? 1 : data & 0x1f;
+    else if(address < 0x6000)  /* RAM bank or upper ROM bank bits */
+        this->bankHigh = data & 0x3;
+    else                       /* Banking mode */
+        this->advancedMode = data & 0x1;
+
+    updateBanks();
+}
+
+
+void MBC1::saveState(StateWriter& state) const
+{
+    MBC::saveState(state);
+    state.write(this->romBankLow);
+    state.write(this->bankHigh);
+    state.write(this->advancedMode);
+}
+
+
+void MBC1::loadState(StateReader& state)
+{
+    MBC::loadState(state);
+    this->romBankLow = state.read<u8>();
+    this->bankHigh = state.read<u8>();
+    if(this->romBankLow == 0 || this->romBankLow > 0x1f || this->bankHigh > 0x3)
+        throw std::runtime_error("Save state has an invalid MBC1 bank register");
+    this->advancedMode = state.readBool();
+}
+
+
+void MBC1::updateBanks()
+{
+    int lowBank = this->advancedMode ? this->bankHigh << 5 : 0;
+    selectRomBanks(lowBank, (this->bankHigh << 5) | this->romBankLow);
+    selectRamBank(this->advancedMode ? this->bankHigh : 0);
+}
+
+
+/**************************************
+ * MBC2
+ *************************************/
+
+MBC2::MBC2(shared_ptr<const RomImage> romImage, int romSize) : MBC(romImage, romSize, 512)
+{
+}
+
+MBC2::~MBC2()
+{
+    clear();
+}
+
+
+MBC* MBC2::clone() const
+{
+    return new MBC2(*this);
+}
+
+
+/**
+ * Address bit 8 selects the register, when set the ROM bank is written otherwise RAM enable.
+ */
+void MBC2::writeRegister(u16 address, u8 data)
+{
+    if(address >= 0x4000)
+        return;
+
+    if(address & 0x100)
+    {
+        int bank = (data & 0xf) == 0 ? 1 : data & 0xf;
+        selectRomBanks(0, bank);
     }
+    else
+        this->ramEnabled = (data & 0xf) == 0xa;
 }
 
 
-void MBC::write(u16 address, u8 data)
+/**
+ * The built-in RAM stores 4 bits per byte and repeats itself over 0xa000-0xbfff. The upper 4 bits
+ * read as ones.
+ */
+u8 MBC2::readRam(u16 address)
 {
-    if(address < 0x8000)
+    if(!this->ramEnabled)
+        return 0xff;
+
+    return 0xf0 | this->ramMem.read(address & 0x1ff);
+}
+
+
+void MBC2::writeRam(u16 address, u8 data)
+{
+    if(this->ramEnabled)
+        this->ramMem.write(address & 0x1ff, data & 0xf);
+}
+
+
+bool MBC2::isRamMemoryMapped() const
+{
+    return false;
+}
+
+
+/**************************************
+ * MBC3
+ *************************************/
+
+MBC3::MBC3(shared_ptr<const RomImage> romImage, int romSize, int ramSize) : MBC(romImage, romSize, ramSize)
+{
+    this->ramBankSelect = 0;
+    this->clockRegisters.fill(0);
+    this->latchedClockRegisters.fill(0);
+    this->latchValue = 0xff;
+}
+
+MBC3::~MBC3()
+{
+    clear();
+}
+
+
+MBC* MBC3::clone() const
+{
+    return new MBC3(*this);
+}
+
+
+void MBC3::writeRegister(u16 address, u8 data)
+{
+    if(address < 0x2000)       /* RAM and clock enable */
+        this->ramEnabled = (data & 0xf) == 0xa;
+    else if(address < 0x4000)  /* ROM bank, bank 0 selects bank 1 */
+        selectRomBanks(0, (data & 0x7f) == 0 ? 1 : data & 0x7f);
+    else if(address < 0x6000)  /* RAM bank or clock register */
     {
-        this->romMem[address] = data;
+        this->ramBankSelect = data & 0xf;
+        if(this->ramBankSelect < 0x8)
+            selectRamBank(this->ramBankSelect & 0x3);
     }
-    else if(address >= 0xa000 && address <= 0xbfff && this->ramSize >= address - 0xa000)
+    else                       /* Writing 0 and then 1 latches the clock registers */
     {
-        this->ramMem[address - 0xa000] = data;
+        if(this->latchValue == 0 && data == 1)
+            this->latchedClockRegisters = this->clockRegisters;
+        this->latchValue = data;
     }
-    else
+}
+
+
+void MBC3::saveState(StateWriter& state) const
+{
+    MBC::saveState(state);
+    state.write(this->ramBankSelect);
+    state.write(this->clockRegisters);
+    state.write(this->latchedClockRegisters);
+    state.write(this->latchValue);
+}
+
+
+void MBC3::loadState(StateReader& state)
+{
+    MBC::loadState(state);
+    this->ramBankSelect = state.read<u8>();
+    this->clockRegisters = state.read<std::array<u8, 5>>();
+    this->latchedClockRegisters = state.read<std::array<u8, 5>>();
+    this->latchValue = state.read<u8>();
+}
+
+
+u8 MBC3::readRam(u16 address)
+{
+    if(this->ramBankSelect >= 0x8 && this->ramBankSelect <= 0xc)
+        return this->ramEnabled ? this->latchedClockRegisters[this->ramBankSelect - 0x8] : 0xff;
+
+    return MBC::readRam(address);
+}
+
+
+void MBC3::writeRam(u16 address, u8 data)
+{
+    if(this->ramBankSelect >= 0x8 && this->ramBankSelect <= 0xc)
     {
-        fmt::format("Invalid cartridge write operation at address {:#x} with data {:#x}", address, data);
+        if(this->ramEnabled)
+        {
+            this->clockRegisters[this->ramBankSelect - 0x8] = data;
+            this->latchedClockRegisters[this->ramBankSelect - 0x8] = data;
+        }
+        return;
     }
+
+    MBC::writeRam(address, data);
 }
 
 
-NoMBC::NoMBC(int romSize, int ramSize) : MBC(romSize, ramSize)
+bool MBC3::isRamMemoryMapped() const
 {
+    return this->ramBankSelect < 0x8 && MBC::isRamMemoryMapped();
 }
 
-NoMBC::~NoMBC()
+
+/**************************************
+ * MBC5
+ *************************************/
+
+MBC5::MBC5(shared_ptr<const RomImage> romImage, int romSize, int ramSize) : MBC(romImage, romSize, ramSize)
+{
+    this->romBank = 1;
+}
+
+MBC5::~MBC5()
 {
     clear();
 }
+
+
+MBC* MBC5::clone() const
+{
+    return new MBC5(*this);
+}
+
+
+void MBC5::writeRegister(u16 address, u8 data)
+{
+    if(address < 0x2000)       /* RAM enable */
+        this->ramEnabled = (data & 0xf) == 0xa;
+    else if(address < 0x3000)  /* Lower 8 bits of the ROM bank, bank 0 can be selected */
+        this->romBank = (this->romBank & 0x100) | data;
+    else if(address < 0x4000)  /* Bit 8 of the ROM bank */
+        this->romBank = (this->romBank & 0xff) | ((data & 0x1) << 8);
+    else if(address < 0x6000)  /* RAM bank */
+        selectRamBank(data & 0xf);
+
+    selectRomBanks(0, this->romBank);
+}
+
+
+void MBC5::saveState(StateWriter& state) const
+{
+    MBC::saveState(state);
+    state.write(this->romBank);
+}
+
+
+void MBC5::loadState(StateReader& state)
+{
+    MBC::loadState(state);
+    this->romBank = state.read<u16>();
+    if(this->romBank > 0x1ff)
+        throw std::runtime_error("Save state has an invalid MBC5 bank register");
+}
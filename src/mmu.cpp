@@ -15,6 +15,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <exception>
 #include <string>
@@ -39,18 +40,66 @@ Mmu::Mmu(std::shared_ptr<GraphicsController> gc, std::shared_ptr<InterruptContro
     this->timer = timer;
 
     /* Memory */
-    ERAM.size = ERAM_END_ADDR - ERAM_START_ADDR + 1;
-    ERAM.mem = new u8[ERAM.size]();
-    WRAM.size = WRAM_END_ADDR - WRAM_START_ADDR + 1;
-    WRAM.mem = new u8[WRAM.size]();
+    ERAM = CowMemory(ERAM_END_ADDR - ERAM_START_ADDR + 1);
+    WRAM = CowMemory(WRAM_END_ADDR - WRAM_START_ADDR + 1);
     HardwareRegisters.size = HARDWARE_REGISTERS_END_ADDR - HARDWARE_REGISTERS_START_ADDR + 1;
     HardwareRegisters.mem = new u8[HardwareRegisters.size]();
     HRAM.size = HRAM_END_ADDR - HRAM_START_ADDR + 1;
     HRAM.mem = new u8[HRAM.size]();
 
+    this->romBanks[0] = 0;
+    this->romBanks[1] = 1;
+    this->pageVersions.fill(0);
+
+    /* Everything that is plain memory is accessed through the page table. */
+    this->readPages.fill(nullptr);
+    this->writePages.fill(nullptr);
+    updateMemoryMap();
+
     initializeMemory();
 }
 
+/**
+ * Forks the memory of another Mmu. The RAM of the Mmu, the cartridge and the graphics controller
+ * is shared page by page until it is written. Both page tables only map the shared pages for
+ * reading afterwards, updateMemoryMap has to be called on the original as well.
+ */
+Mmu::Mmu(const Mmu& other, std::shared_ptr<GraphicsController> gc,
+    std::shared_ptr<InterruptController> ic, std::shared_ptr<Timer> timer,
+    std::shared_ptr<Joypad> joypad) : rom(other.rom)
+{
+    assert(gc != nullptr);
+    assert(ic != nullptr);
+    assert(timer != nullptr);
+    assert(joypad != nullptr);
+
+    this->graphicsController = gc;
+    this->interruptController = ic;
+    this->joypad = joypad;
+    this->timer = timer;
+
+    /* The hardware registers and HRAM are smaller than a page, they are copied. */
+    ERAM = other.ERAM;
+    WRAM = other.WRAM;
+    HardwareRegisters.size = other.HardwareRegisters.size;
+    HardwareRegisters.mem = new u8[HardwareRegisters.size];
+    copy(other.HardwareRegisters.mem, other.HardwareRegisters.mem + HardwareRegisters.size,
+        HardwareRegisters.mem);
+    HRAM.size = other.HRAM.size;
+    HRAM.mem = new u8[HRAM.size];
+    copy(other.HRAM.mem, other.HRAM.mem + HRAM.size, HRAM.mem);
+    this->serialOutput = other.serialOutput;
+
+    this->romBanks[0] = other.romBanks[0];
+    this->romBanks[1] = other.romBanks[1];
+    this->pageVersions = other.pageVersions;
+
+    this->readPages.fill(nullptr);
+    this->writePages.fill(nullptr);
+    updateCartridgeBanks();
+    updateMemoryMap();
+}
+
 Mmu::~Mmu()
 {
 }
@@ -105,13 +154,11 @@ void Mmu::shutDown()
     // this->interruptController = nullptr;
     // this->timer = nullptr;
 
-    delete[] ERAM.mem;
-    ERAM.mem = nullptr;
-    ERAM.size = 0;
+    this->readPages.fill(nullptr);
+    this->writePages.fill(nullptr);
 
-    delete[] WRAM.mem;
-    WRAM.mem = nullptr;
-    WRAM.size = 0;
+    ERAM.clear();
+    WRAM.clear();
 
     delete[] HardwareRegisters.mem;
     HardwareRegisters.mem = nullptr;
@@ -123,20 +170,25 @@ void Mmu::shutDown()
 }
 
 
-u8 Mmu::read(u16 addr)
+/**
+ * Reads memory that is not mapped in the page table.
+ */
+u8 Mmu::readSlow(u16 addr)
 {
     assert(this->graphicsController != nullptr);
 
     u8 data = 0;
 
-    if(addr <= ROM_END_ADDR) /* ROM banks */
+    if(addr >= HRAM_START_ADDR && addr <= HRAM_END_ADDR) /* High RAM (HRAM), shares a page with the I/O ports */
+        data = HRAM.mem[addr - HRAM_START_ADDR];
+    else if(addr <= ROM_END_ADDR) /* ROM banks */
         data = rom.read(addr);
     else if(addr >= VRAM_START_ADDR && addr <= VRAM_END_ADDR) /* VRAM / LCD Display RAM */
         data = this->graphicsController->vramRead(addr - VRAM_START_ADDR);
     else if(addr >= ERAM_START_ADDR && addr <= ERAM_END_ADDR) /* Switchable external RAM bank */
-        data = ERAM.mem[addr - ERAM_START_ADDR];
+        data = rom.hasRam() ? rom.read(addr) : ERAM.read(addr - ERAM_START_ADDR);
     else if(addr >= WRAM_START_ADDR && addr <= WRAM_END_ADDR) /* Working RAM bank 0 */
-        data = WRAM.mem[addr - WRAM_START_ADDR];
+        data = WRAM.read(addr - WRAM_START_ADDR);
     else if(addr > WRAM_END_ADDR && addr < OAM_START_ADDR) /* Echo ram, typically not used. */
         fmt::print(stderr, "Error, read request for echo RAM is not supported\n");
     else if(addr >= OAM_START_ADDR && addr <= OAM_END_ADDR) /* Sprite attribute table / OAM (Object Actribute Mem) */
@@ -145,8 +197,6 @@ u8 Mmu::read(u16 addr)
         fmt::print(stderr, "Error, read request for unusable memory at address: {:#x}\n", addr);
     else if(addr >= HARDWARE_REGISTERS_START_ADDR && addr <= HARDWARE_REGISTERS_END_ADDR) /* I/O Ports */
         data = readHardwareRegister(addr);
-    else if(addr >= HRAM_START_ADDR && addr <= HRAM_END_ADDR) /* High RAM (HRAM) */
-        data = HRAM.mem[addr - HRAM_START_ADDR];
     else if(addr == IE_ADDR)
         data = this->interruptController->getIE();
 
@@ -154,34 +204,37 @@ u8 Mmu::read(u16 addr)
 }
 
 /**
- * Fetches 16 bits from memory by stitching 2 bytes together. The first byte is the low byte and
- * the second byte is the high byte.
+ * Writes memory that is not mapped in the page table.
  */
-u16 Mmu::read2Bytes(u16 addr)
-{
-    /* Get the low and high u8 of the 16 bit address. */
-    u16 low = read(addr);
-    u16 high = read(addr + 1);
-
-    /* Construct the address. */
-    u16 word = (high << 8) + low;
-
-    return word;
-}
-
-
-void Mmu::write(u16 addr, u8 data)
+void Mmu::writeSlow(u16 addr, u8 data)
 {
     assert(graphicsController != nullptr);
 
-    if(addr <= ROM_END_ADDR) /* ROM banks */
+    if(addr >= HRAM_START_ADDR && addr <= HRAM_END_ADDR) /* High RAM (HRAM), shares a page with the I/O ports */
+        HRAM.mem[addr - HRAM_START_ADDR] = data;
+    else if(addr <= ROM_END_ADDR) /* ROM banks */
+    {
         rom.write(addr, data);
+        updateCartridgeBanks();
+    }
     else if(addr >= VRAM_START_ADDR && addr <= VRAM_END_ADDR) /* VRAM / LCD Display RAM */
+    {
         this->graphicsController->vramWrite(addr - VRAM_START_ADDR, data);
+        mapRamPage(addr);
+    }
     else if(addr >= ERAM_START_ADDR && addr <= ERAM_END_ADDR) /* Switchable external RAM bank */
-        ERAM.mem[addr - ERAM_START_ADDR] = data;
+    {
+        if(rom.hasRam())
+            rom.write(addr, data);
+        else
+            ERAM.write(addr - ERAM_START_ADDR, data);
+        mapRamPage(addr);
+    }
     else if(addr >= WRAM_START_ADDR && addr <= WRAM_END_ADDR) /* Working RAM bank 0 */
-        WRAM.mem[addr - WRAM_START_ADDR] = data;
+    {
+        WRAM.write(addr - WRAM_START_ADDR, data);
+        mapRamPage(addr);
+    }
     else if(addr > WRAM_END_ADDR && addr < OAM_START_ADDR) /* Echo ram, typically not used. */
     {
         fmt::print(stderr, "Error, unsupported write action for echo RAM on address: {:#x}\n", addr);
@@ -193,26 +246,11 @@ void Mmu::write(u16 addr, u8 data)
         // fmt::print(stderr, "Error, write request for unusable memory at address: {:#x}, data: {:#x}\n", addr, data);
     else if(addr >= HARDWARE_REGISTERS_START_ADDR && addr <= HARDWARE_REGISTERS_END_ADDR) /* I/O Ports */
         writeHardwareRegister(addr, data);
-    else if(addr >= HRAM_START_ADDR && addr <= HRAM_END_ADDR) /* High RAM (HRAM) */
-        HRAM.mem[addr - HRAM_START_ADDR] = data;
     else if(addr == IE_ADDR)
         this->interruptController->setIE(data);
 }
 
 
-/**
- * Writes two bytes of data to memory.
- */
-void Mmu::write2Bytes(u16 addr, u16 data)
-{
-    u8 low = data & 0xff;
-    u8 high = (data >> 8) & 0xff;
-
-    this->write(addr, low);
-    this->write(addr + 1, high);
-}
-
-
 void Mmu::loadRom(string fileName)
 {
     try
@@ -226,6 +264,87 @@ void Mmu::loadRom(string fileName)
     }
 
     this->rom.printInfo();
+    updateCartridgeBanks();
+}
+
+
+/**
+ * Points the page table entries of an address range to host memory. A nullptr sends the accesses
+ * to the slow path.
+ */
+void Mmu::mapPages(u16 startAddr, u16 endAddr, const u8* readMem, u8* writeMem)
+{
+    for(unsigned int page = startAddr >> 8; page <= (unsigned int)(endAddr >> 8); page++)
+    {
+        unsigned int offset = (page << 8) - startAddr;
+        this->readPages[page] = readMem != nullptr ? readMem + offset : nullptr;
+        this->writePages[page] = writeMem != nullptr ? writeMem + offset : nullptr;
+    }
+}
+
+
+/**
+ * Points the page table entry of a VRAM, external RAM or working RAM address to the page that
+ * currently holds it. A page that is shared with a fork is only mapped for reading, the first
+ * write takes the slow path and copies the page.
+ */
+void Mmu::mapRamPage(u16 addr)
+{
+    const u8* readPage = nullptr;
+    u8* writePage = nullptr;
+
+    if(addr >= VRAM_START_ADDR && addr <= VRAM_END_ADDR)
+        readPage = this->graphicsController->getVramPage(addr - VRAM_START_ADDR);
+    else if(addr >= ERAM_START_ADDR && addr <= ERAM_END_ADDR && this->rom.hasRam())
+    {
+        readPage = this->rom.getRamPage(addr);
+        writePage = this->rom.getWritableRamPage(addr);
+    }
+    else if(addr >= ERAM_START_ADDR && addr <= ERAM_END_ADDR) /* Provided by the Mmu itself */
+    {
+        readPage = ERAM.getPage(addr - ERAM_START_ADDR);
+        if(!ERAM.isPageShared(addr - ERAM_START_ADDR))
+            writePage = ERAM.getWritablePage(addr - ERAM_START_ADDR);
+    }
+    else if(addr >= WRAM_START_ADDR && addr <= WRAM_END_ADDR)
+    {
+        readPage = WRAM.getPage(addr - WRAM_START_ADDR);
+        if(!WRAM.isPageShared(addr - WRAM_START_ADDR))
+            writePage = WRAM.getWritablePage(addr - WRAM_START_ADDR);
+    }
+
+    this->readPages[addr >> 8] = readPage;
+    this->writePages[addr >> 8] = writePage;
+}
+
+
+void Mmu::updateMemoryMap()
+{
+    for(unsigned int page = VRAM_START_ADDR >> 8; page <= (WRAM_END_ADDR >> 8); page++)
+        mapRamPage(page << 8);
+}
+
+
+/**
+ * Stores the ROM banks that the cartridge currently maps into the address space and points the
+ * ROM and external RAM pages to them. ROM writes always take the slow path as they control the
+ * MBC. External RAM that the MBC can not expose as plain memory, like disabled RAM or the MBC3
+ * clock registers, takes the slow path as well.
+ */
+void Mmu::updateCartridgeBanks()
+{
+    this->romBanks[0] = this->rom.getRomBank(0x0000);
+    this->romBanks[1] = this->rom.getRomBank(0x4000);
+
+    mapPages(0x0000, 0x3fff, this->rom.getRomBankData(0x0000), nullptr);
+    mapPages(0x4000, ROM_END_ADDR, this->rom.getRomBankData(0x4000), nullptr);
+
+    for(unsigned int page = ERAM_START_ADDR >> 8; page <= (ERAM_END_ADDR >> 8); page++)
+        mapRamPage(page << 8);
+
+    /* The contents behind the external RAM pages may have changed. */
+    for(unsigned int page = ERAM_START_ADDR >> 8; page <= (ERAM_END_ADDR >> 8); page++)
+        this->pageVersions[page]++;
 }
 
 
@@ -240,6 +359,67 @@ void Mmu::DMATransfer(u8 index)
     }
 }
 
+/**
+ * Writes the serial control register. A transfer that is started with the internal clock
+ * completes immediately, the byte in SB is captured and no other Game Boy is connected so 0xff is
+ * received.
+ */
+void Mmu::serialTransfer(u8 control)
+{
+    if((control & 0x81) != 0x81)
+    {
+        HardwareRegisters.mem[SC_ADDR - HARDWARE_REGISTERS_START_ADDR] = control;
+        return;
+    }
+
+    this->serialOutput.push_back(HardwareRegisters.mem[SB_ADDR - HARDWARE_REGISTERS_START_ADDR]);
+    HardwareRegisters.mem[SB_ADDR - HARDWARE_REGISTERS_START_ADDR] = 0xff;
+    HardwareRegisters.mem[SC_ADDR - HARDWARE_REGISTERS_START_ADDR] = control & 0x7f;
+    interruptController->requestInterrupt(int_serial_transfer_completion);
+}
+
+
+const vector<u8>& Mmu::getSerialOutput() const
+{
+    return this->serialOutput;
+}
+
+
+void Mmu::clearSerialOutput()
+{
+    this->serialOutput.clear();
+}
+
+
+/**
+ * Stores the RAM of the Mmu and the cartridge. The serial output is not part of the state.
+ */
+void Mmu::saveState(StateWriter& state) const
+{
+    ERAM.saveState(state);
+    WRAM.saveState(state);
+    state.writeBytes(HardwareRegisters.mem, HardwareRegisters.size);
+    state.writeBytes(HRAM.mem, HRAM.size);
+    this->rom.saveState(state);
+}
+
+
+void Mmu::loadState(StateReader& state)
+{
+    ERAM.loadState(state);
+    WRAM.loadState(state);
+    state.readBytes(HardwareRegisters.mem, HardwareRegisters.size);
+    state.readBytes(HRAM.mem, HRAM.size);
+    this->rom.loadState(state);
+    updateCartridgeBanks();
+    updateMemoryMap();
+
+    /* Every page may have changed, this invalidates the decoded instructions of RAM pages. */
+    for(u32& version : this->pageVersions)
+        version++;
+}
+
+
 u8 Mmu::readHardwareRegister(u16 addr)
 {
     assert(graphicsController != nullptr);
@@ -283,6 +463,7 @@ void Mmu::writeHardwareRegister(u16 addr, u8 data)
     switch(addr)
     {
         case P1_ADDR:   joypad->write(data); break;
+        case SC_ADDR:   serialTransfer(data); break;
         case DIV_ADDR:  timer->write(RegDIV, data); break;
         case TIMA_ADDR: timer->write(RegTIMA, data); break;
         case TMA_ADDR:  timer->write(RegTMA, data); break;
@@ -15,4535 +15,835 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <cstring>
+#include <array>
+#include <utility>
 #include <fmt/format.h>
 #include "polarGB/cpu.h"
 
 
-void Cpu::decodeOpcode(instruction_t *instr, u8 opcode)
+/* Helpers for describing the operand shapes in the opcode tables below. Immediate values that
+ * follow the opcode in memory are filled in by the decoder. */
+constexpr operand_t opNone()
 {
-    /* Initialising the instruction struct variables. */
-    instr->instructionLength = 0;
-    strcpy(instr->mnemonic, "UNSUPPORTED");
-    instr->operandSrc.type = OP_NONE;
-    instr->operandSrc.reg = RegID_NONE;
-    instr->operandSrc.memPtr = RegID_NONE;
-    instr->operandSrc.immediate = 0;
-    instr->operandDst.type = OP_NONE;
-    instr->operandDst.reg = RegID_NONE;
-    instr->operandDst.memPtr = RegID_NONE;
-    instr->operandDst.immediate = 0;
-    instr->cycleCost = 0;
-    instr->extraInfo = 0;
-    instr->executionFunction = nullptr;
-
-
-    switch(opcode)
-    {
-        case 0x0: /* NOP */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeNOP;
-            strcpy(instr->mnemonic, "NOP");
-            break;
-        case 0x1: /* LD BC, d16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_BC;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD16;
-            strcpy(instr->mnemonic, "LD BC, d16");
-            break;
-        case 0x2: /* LD (BC), A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_BC;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (BC), A");
-            break;
-        case 0x3: /* INC BC */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_BC;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeINC16;
-            strcpy(instr->mnemonic, "INC BC");
-            break;
-        case 0x4: /* INC B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC B");
-            break;
-        case 0x5: /* DEC B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC B");
-            break;
-        case 0x6: /* LD B, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, d8");
-            break;
-        case 0x7: /* RLCA */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeRLCA;
-            strcpy(instr->mnemonic, "RLCA");
-            break;
-        case 0x8: /* LD (a16), SP */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_SP;
-            instr->operandDst.type = OP_IMM_PTR;
-            instr->operandDst.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 5;
-            instr->executionFunction = &Cpu::executeLD16;
-            strcpy(instr->mnemonic, "LD (a16), SP");
-            break;
-        case 0x9: /* ADD HL, BC */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_BC;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADD16;
-            strcpy(instr->mnemonic, "ADD HL, BC");
-            break;
-        case 0xA: /* LD A, (BC) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_BC;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, (BC)");
-            break;
-        case 0xB: /* DEC BC */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_BC;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeDEC16;
-            strcpy(instr->mnemonic, "DEC BC");
-            break;
-        case 0xC: /* INC C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC C");
-            break;
-        case 0xD: /* DEC C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC C");
-            break;
-        case 0xE: /* LD C, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, d8");
-            break;
-        case 0xF: /* RRCA */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeRRCA;
-            strcpy(instr->mnemonic, "RRCA");
-            break;
-        // case 0x10: /* STOP */
-            // break;
-        case 0x11: /* LD DE, d16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_DE;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD16;
-            strcpy(instr->mnemonic, "LD DE, d16");
-            break;
-        case 0x12: /* LD (DE), A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_DE;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (DE), A");
-            break;
-        case 0x13: /* INC DE */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_DE;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeINC16;
-            strcpy(instr->mnemonic, "INC DE");
-            break;
-        case 0x14: /* INC D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC D");
-            break;
-        case 0x15: /* DEC D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC D");
-            break;
-        case 0x16: /* LD D, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, d8");
-            break;
-        case 0x17: /* RLA */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeRLA;
-            strcpy(instr->mnemonic, "RLA");
-            break;
-        case 0x18: /* JR r8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_PC;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeJR;
-            strcpy(instr->mnemonic, "JR r8");
-            break;
-        case 0x19: /* ADD HL, DE */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_DE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADD16;
-            strcpy(instr->mnemonic, "ADD HL, DE");
-            break;
-        case 0x1A: /* LD A, (DE) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_DE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, (DE)");
-            break;
-        case 0x1B: /* DEC DE */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_DE;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeDEC16;
-            strcpy(instr->mnemonic, "DEC DE");
-            break;
-        case 0x1C: /* INC E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC E");
-            break;
-        case 0x1D: /* DEC E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC E");
-            break;
-        case 0x1E: /* LD E, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, d8");
-            break;
-        case 0x1F: /* RRA */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeRRA;
-            strcpy(instr->mnemonic, "RRA");
-            break;
-        case 0x20: /* JR NZ, r8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_PC;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NZ;
-            instr->executionFunction = &Cpu::executeJR;
-            strcpy(instr->mnemonic, "JR NZ, r8");
-            break;
-        case 0x21: /* LD HL, d16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD16;
-            strcpy(instr->mnemonic, "LD HL, d16");
-            break;
-        case 0x22: /* LD (HL+), A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8Inc;
-            strcpy(instr->mnemonic, "LD (HLI), A");
-            break;
-        case 0x23: /* INC HL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeINC16;
-            strcpy(instr->mnemonic, "INC HL");
-            break;
-        case 0x24: /* INC H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC H");
-            break;
-        case 0x25: /* DEC H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC H");
-            break;
-        case 0x26: /* LD H, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, d8");
-            break;
-        case 0x27: /* DAA */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDAA;
-            strcpy(instr->mnemonic, "DAA");
-            break;
-        case 0x28: /* JR Z, r8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_PC;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_Z;
-            instr->executionFunction = &Cpu::executeJR;
-            strcpy(instr->mnemonic, "JR Z, r8");
-            break;
-        case 0x29: /* ADD HL, HL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADD16;
-            strcpy(instr->mnemonic, "ADD HL, HL");
-            break;
-        case 0x2A: /* LD A, (HL+) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8Inc;
-            strcpy(instr->mnemonic, "LD A, (HLI)");
-            break;
-        case 0x2B: /* DEC HL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeDEC16;
-            strcpy(instr->mnemonic, "DEC HL");
-            break;
-        case 0x2C: /* INC L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC L");
-            break;
-        case 0x2D: /* DEC L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC L");
-            break;
-        case 0x2E: /* LD L, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, d8");
-            break;
-        case 0x2F: /* CPL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCPL;
-            strcpy(instr->mnemonic, "CPL");
-            break;
-        case 0x30: /* JR NC, r8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_PC;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NC;
-            instr->executionFunction = &Cpu::executeJR;
-            strcpy(instr->mnemonic, "JR NC, r8");
-            break;
-        case 0x31: /* LD SP, d16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_SP;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD16;
-            strcpy(instr->mnemonic, "LD SP, d16");
-            break;
-        case 0x32: /* LD (HL-), A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8Dec;
-            strcpy(instr->mnemonic, "LD (HLD), A");
-            break;
-        case 0x33: /* INC SP */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_SP;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeINC16;
-            strcpy(instr->mnemonic, "INC SP");
-            break;
-        case 0x34: /* INC (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC (HL)");
-            break;
-        case 0x35: /* DEC (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC (HL)");
-            break;
-        case 0x36: /* LD (HL), d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), d8");
-            break;
-        case 0x37: /* SCF */
-            instr->instructionLength = 1;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSCF;
-            strcpy(instr->mnemonic, "SCF");
-            break;
-        case 0x38: /* JR C, r8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_PC;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_C;
-            instr->executionFunction = &Cpu::executeJR;
-            strcpy(instr->mnemonic, "JR C, r8");
-            break;
-        case 0x39: /* ADD HL, SP */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_SP;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADD16;
-            strcpy(instr->mnemonic, "ADD HL, SP");
-            break;
-        case 0x3A: /* LD A, (HL-) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8Dec;
-            strcpy(instr->mnemonic, "LD A, (HLD)");
-            break;
-        case 0x3B: /* DEC SP */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_SP;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeDEC16;
-            strcpy(instr->mnemonic, "DEC SP");
-            break;
-        case 0x3C: /* INC A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeINC8;
-            strcpy(instr->mnemonic, "INC A");
-            break;
-        case 0x3D: /* DEC A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_NONE;
-            instr->operandSrc.memPtr = RegID_NONE;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDEC8;
-            strcpy(instr->mnemonic, "DEC A");
-            break;
-        case 0x3E: /* LD A, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, d8");
-            break;
-        case 0x3F: /* CCF */
-            instr->instructionLength = 1;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCCF;
-            strcpy(instr->mnemonic, "CCF");
-            break;
-        case 0x40: /* LD B, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, B");
-            break;
-        case 0x41: /* LD B, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, C");
-            break;
-        case 0x42: /* LD B, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, D");
-            break;
-        case 0x43: /* LD B, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, E");
-            break;
-        case 0x44: /* LD B, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, H");
-            break;
-        case 0x45: /* LD B, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, L");
-            break;
-        case 0x46: /* LD B, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, (HL)");
-            break;
-        case 0x47: /* LD B, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD B, A");
-            break;
-        case 0x48: /* LD C, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, B");
-            break;
-        case 0x49: /* LD C, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, C");
-            break;
-        case 0x4A: /* LD C, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, D");
-            break;
-        case 0x4B: /* LD C, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, E");
-            break;
-        case 0x4C: /* LD C, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, H");
-            break;
-        case 0x4D: /* LD C, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, L");
-            break;
-        case 0x4E: /* LD C, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, (HL)");
-            break;
-        case 0x4F: /* LD C, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD C, A");
-            break;
-        case 0x50: /* LD D, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, B");
-            break;
-        case 0x51: /* LD D, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, C");
-            break;
-        case 0x52: /* LD D, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, D");
-            break;
-        case 0x53: /* LD D, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, E");
-            break;
-        case 0x54: /* LD D, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, H");
-            break;
-        case 0x55: /* LD D, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, L");
-            break;
-        case 0x56: /* LD D, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, (HL)");
-            break;
-        case 0x57: /* LD D, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD D, A");
-            break;
-        case 0x58: /* LD E, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, B");
-            break;
-        case 0x59: /* LD E, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, C");
-            break;
-        case 0x5A: /* LD E, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, D");
-            break;
-        case 0x5B: /* LD E, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, E");
-            break;
-        case 0x5C: /* LD E, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, H");
-            break;
-        case 0x5D: /* LD E, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, L");
-            break;
-        case 0x5E: /* LD E, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, (HL)");
-            break;
-        case 0x5F: /* LD E, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD E, A");
-            break;
-        case 0x60: /* LD H, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, B");
-            break;
-        case 0x61: /* LD H, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, C");
-            break;
-        case 0x62: /* LD H, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, D");
-            break;
-        case 0x63: /* LD H, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, E");
-            break;
-        case 0x64: /* LD H, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, H");
-            break;
-        case 0x65: /* LD H, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, L");
-            break;
-        case 0x66: /* LD H, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, (HL)");
-            break;
-        case 0x67: /* LD H, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD H, A");
-            break;
-        case 0x68: /* LD L, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, B");
-            break;
-        case 0x69: /* LD L, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, C");
-            break;
-        case 0x6A: /* LD L, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, D");
-            break;
-        case 0x6B: /* LD L, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, E");
-            break;
-        case 0x6C: /* LD L, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, H");
-            break;
-        case 0x6D: /* LD L, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, L");
-            break;
-        case 0x6E: /* LD L, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, (HL)");
-            break;
-        case 0x6F: /* LD L, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD L, A");
-            break;
-        case 0x70: /* LD (HL), B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), B");
-            break;
-        case 0x71: /* LD (HL), C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), C");
-            break;
-        case 0x72: /* LD (HL), D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), D");
-            break;
-        case 0x73: /* LD (HL), E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), E");
-            break;
-        case 0x74: /* LD (HL), H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), H");
-            break;
-        case 0x75: /* LD (HL), L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), L");
-            break;
-        case 0x76: /* HALT */
-            instr->instructionLength = 1;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeHALT;
-            strcpy(instr->mnemonic, "HALT");
-            break;
-        case 0x77: /* LD (HL), A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (HL), A");
-            break;
-        case 0x78: /* LD A, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, B");
-            break;
-        case 0x79: /* LD A, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, C");
-            break;
-        case 0x7A: /* LD A, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, D");
-            break;
-        case 0x7B: /* LD A, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, E");
-            break;
-        case 0x7C: /* LD A, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, H");
-            break;
-        case 0x7D: /* LD A, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, L");
-            break;
-        case 0x7E: /* LD A, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, (HL)");
-            break;
-        case 0x7F: /* LD A, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, A");
-            break;
-        case 0x80: /* ADD A, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, B");
-            break;
-        case 0x81: /* ADD A, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, C");
-            break;
-        case 0x82: /* ADD A, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, D");
-            break;
-        case 0x83: /* ADD A, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, E");
-            break;
-        case 0x84: /* ADD A, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, H");
-            break;
-        case 0x85: /* ADD A, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, L");
-            break;
-        case 0x86: /* ADD A, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, (HL)");
-            break;
-        case 0x87: /* ADD A, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, A");
-            break;
-        case 0x88: /* ADC A, B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, B");
-            break;
-        case 0x89: /* ADC A, C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, C");
-            break;
-        case 0x8A: /* ADC A, D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, D");
-            break;
-        case 0x8B: /* ADC A, E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, E");
-            break;
-        case 0x8C: /* ADC A, H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, H");
-            break;
-        case 0x8D: /* ADC A, L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, L");
-            break;
-        case 0x8E: /* ADC A, (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, (HL)");
-            break;
-        case 0x8F: /* ADC A, A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, A");
-            break;
-        case 0x90: /* SUB B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB B");
-            break;
-        case 0x91: /* SUB C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB C");
-            break;
-        case 0x92: /* SUB D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB D");
-            break;
-        case 0x93: /* SUB E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB E");
-            break;
-        case 0x94: /* SUB H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB H");
-            break;
-        case 0x95: /* SUB L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB L");
-            break;
-        case 0x96: /* SUB (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB B");
-            break;
-        case 0x97: /* SUB A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB A");
-            break;
-        case 0x98: /* SBC B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, B");
-            break;
-        case 0x99: /* SBC C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, C");
-            break;
-        case 0x9A: /* SBC D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, D");
-            break;
-        case 0x9B: /* SBC E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, E");
-            break;
-        case 0x9C: /* SBC H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, H");
-            break;
-        case 0x9D: /* SBC L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, L");
-            break;
-        case 0x9E: /* SBC (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, (HL)");
-            break;
-        case 0x9F: /* SBC A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC A, A");
-            break;
-        case 0xA0: /* AND B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND B");
-            break;
-        case 0xA1: /* AND C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND C");
-            break;
-        case 0xA2: /* AND D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND D");
-            break;
-        case 0xA3: /* AND E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND E");
-            break;
-        case 0xA4: /* AND H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND H");
-            break;
-        case 0xA5: /* AND L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND L");
-            break;
-        case 0xA6: /* AND (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND (HL)");
-            break;
-        case 0xA7: /* AND A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND A");
-            break;
-        case 0xA8: /* XOR B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR B");
-            break;
-        case 0xA9: /* XOR C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR C");
-            break;
-        case 0xAA: /* XOR D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR D");
-            break;
-        case 0xAB: /* XOR E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR E");
-            break;
-        case 0xAC: /* XOR H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR H");
-            break;
-        case 0xAD: /* XOR L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR L");
-            break;
-        case 0xAE: /* XOR (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR (HL)");
-            break;
-        case 0xAF: /* XOR A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR A");
-            break;
-        case 0xB0: /* OR B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR B");
-            break;
-        case 0xB1: /* OR C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR C");
-            break;
-        case 0xB2: /* OR D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR D");
-            break;
-        case 0xB3: /* OR E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR E");
-            break;
-        case 0xB4: /* OR H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR H");
-            break;
-        case 0xB5: /* OR L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR L");
-            break;
-        case 0xB6: /* OR (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR (HL)");
-            break;
-        case 0xB7: /* OR A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR A");
-            break;
-        case 0xB8: /* CP B */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP B");
-            break;
-        case 0xB9: /* CP C */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP C");
-            break;
-        case 0xBA: /* CP D */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP D");
-            break;
-        case 0xBB: /* CP E */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP E");
-            break;
-        case 0xBC: /* CP H */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP H");
-            break;
-        case 0xBD: /* CP L */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP L");
-            break;
-        case 0xBE: /* CP (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP (HL)");
-            break;
-        case 0xBF: /* CP A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP A");
-            break;
-        case 0xC0: /* RET NZ */
-            instr->instructionLength = 1;
-            instr->cycleCost = 5;
-            instr->executionFunction = &Cpu::executeRET;
-            instr->extraInfo = COND_NZ;
-            strcpy(instr->mnemonic, "RET NZ");
-            break;
-        case 0xC1: /* POP BC */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_SP;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_BC;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePOP;
-            strcpy(instr->mnemonic, "POP BC");
-            break;
-        case 0xC2: /* JP NZ, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NZ;
-            instr->executionFunction = &Cpu::executeJP;
-            strcpy(instr->mnemonic, "JP NZ, a16");
-            break;
-        case 0xC3: /* JP a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeJP;
-            strcpy(instr->mnemonic, "JP a16");
-            break;
-        case 0xC4: /* CALL NZ, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 6;
-            instr->extraInfo = COND_NZ;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "CALL NZ, a16");
-            break;
-        case 0xC5: /* PUSH BC */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_BC;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_SP;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePUSH;
-            strcpy(instr->mnemonic, "PUSH BC");
-            break;
-        case 0xC6: /* ADD A, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADD8;
-            strcpy(instr->mnemonic, "ADD A, d8");
-            break;
-        case 0xC7: /* RST 0x00 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0000;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x00");
-            break;
-        case 0xC8: /* RET Z */
-            instr->instructionLength = 1;
-            instr->cycleCost = 5;
-            instr->executionFunction = &Cpu::executeRET;
-            instr->extraInfo = COND_Z;
-            strcpy(instr->mnemonic, "RET Z");
-            break;
-        case 0xC9: /* RET */
-            instr->instructionLength = 1;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRET;
-            strcpy(instr->mnemonic, "RET");
-            break;
-        case 0xCA: /* JP Z, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_Z;
-            instr->executionFunction = &Cpu::executeJP;
-            strcpy(instr->mnemonic, "JP Z, a16");
-            break;
-        case 0xCB: /* PREFIX CB */
-            decodePrefixedOpcode(instr);
-            break;
-        case 0xCC: /* CALL Z, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 6;
-            instr->extraInfo = COND_Z;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "CALL Z, a16");
-            break;
-        case 0xCD: /* CALL a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 6;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "CALL a16");
-            break;
-        case 0xCE: /* ADC A, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeADC;
-            strcpy(instr->mnemonic, "ADC A, d8");
-            break;
-        case 0xCF: /* RST 0x08 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0008;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x08");
-            break;
-        case 0xD0: /* RET NC */
-            instr->instructionLength = 1;
-            instr->cycleCost = 5;
-            instr->executionFunction = &Cpu::executeRET;
-            instr->extraInfo = COND_NC;
-            strcpy(instr->mnemonic, "RET NC");
-            break;
-        case 0xD1: /* POP DE */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_SP;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_DE;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePOP;
-            strcpy(instr->mnemonic, "POP DE");
-            break;
-        case 0xD2: /* JP NC, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NC;
-            instr->executionFunction = &Cpu::executeJP;
-            strcpy(instr->mnemonic, "JP NC, a16");
-            break;
-        // case 0xD3: /* No instruction */
-        //     break;
-        case 0xD4: /* CALL NC, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 6;
-            instr->extraInfo = COND_NC;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "CALL NC, a16");
-            break;
-        case 0xD5: /* PUSH DE */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_DE;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_SP;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePUSH;
-            strcpy(instr->mnemonic, "PUSH DE");
-            break;
-        case 0xD6: /* SUB d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeSUB;
-            strcpy(instr->mnemonic, "SUB d8");
-            break;
-        case 0xD7: /* RST 0x10 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0010;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x10");
-            break;
-        case 0xD8: /* RET C */
-            instr->instructionLength = 1;
-            instr->cycleCost = 5;
-            instr->executionFunction = &Cpu::executeRET;
-            instr->extraInfo = COND_C;
-            strcpy(instr->mnemonic, "RET C");
-            break;
-        case 0xD9: /* RETI */
-            instr->instructionLength = 1;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRET;
-            instr->extraInfo = COND_IE;
-            strcpy(instr->mnemonic, "RETI");
-            break;
-        case 0xDA: /* JP C, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_C;
-            instr->executionFunction = &Cpu::executeJP;
-            strcpy(instr->mnemonic, "JP C, a16");
-            break;
-        // case 0xDB: /* No instruction */
-        //     break;
-        case 0xDC: /* CALL C, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 6;
-            instr->extraInfo = COND_C;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "CALL C, a16");
-            break;
-        // case 0xDD: /* No instruction */
-        //     break;
-        case 0xDE: /* SBC A, d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeSBC;
-            strcpy(instr->mnemonic, "SBC d8");
-            break;
-        case 0xDF: /* RST 0x18 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0018;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x18");
-            break;
-        case 0xE0: /* LD (a8), A */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_IMM_PTR;
-            instr->operandDst.immediate = mmu->read(reg.read(RegID_PC) + 1) + 0xff00;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (a8), A");
-            break;
-        case 0xE1: /* POP HL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_SP;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePOP;
-            strcpy(instr->mnemonic, "POP HL");
-            break;
-        case 0xE2: /* LD (C), A */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_IMM_PTR;
-            instr->operandDst.immediate = reg.read(RegID_C) + 0xff00;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (C), A");
-            break;
-        // case 0xE3: /* No instruction */
-        //     break;
-        // case 0xE4: /* No instruction */
-        //     break;
-        case 0xE5: /* PUSH HL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_SP;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePUSH;
-            strcpy(instr->mnemonic, "PUSH HL");
-            break;
-        case 0xE6: /* AND d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeAND;
-            strcpy(instr->mnemonic, "AND d8");
-            break;
-        case 0xE7: /* RST 0x20 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0020;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x20");
-            break;
-        case 0xE8: /* ADD SP, e */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_SP;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeADD16SPe;
-            strcpy(instr->mnemonic, "ADD SP, e");
-            break;
-        case 0xE9: /* JP (HL) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_HL;
-            instr->cycleCost = 1;
-            instr->extraInfo = COND_HL;
-            instr->executionFunction = &Cpu::executeJP;
-            strcpy(instr->mnemonic, "JP (HL)");
-            break;
-        case 0xEA: /* LD a16, A */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_IMM_PTR;
-            instr->operandDst.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD (a16), A");
-            break;
-        // case 0xEB: /* No instruction */
-        //     break;
-        // case 0xEC: /* No instruction */
-        //     break;
-        // case 0xED: /* No instruction */
-        //     break;
-        case 0xEE: /* XOR d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeXOR;
-            strcpy(instr->mnemonic, "XOR d8");
-            break;
-        case 0xEF: /* RST 0x28 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0028;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x28");
-            break;
-        case 0xF0: /* LD A, (a8) */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM_PTR;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1) + 0xff00;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, (a8)");
-            break;
-        case 0xF1: /* POP AF */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_SP;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_AF;
-            instr->cycleCost = 3;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePOP;
-            strcpy(instr->mnemonic, "POP AF");
-            break;
-        case 0xF2: /* LD A, (C) */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM_PTR;
-            instr->operandSrc.immediate = reg.read(RegID_C) + 0xff00;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, (C)");
-            break;
-        case 0xF3: /* DI */
-            instr->instructionLength = 1;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeDI;
-            strcpy(instr->mnemonic, "DI");
-            break;
-        // case 0xF4: /* No instruction */
-        //     break;
-        case 0xF5: /* PUSH AF */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_AF;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_SP;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executePUSH;
-            strcpy(instr->mnemonic, "PUSH AF");
-            break;
-        case 0xF6: /* OR d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeOR;
-            strcpy(instr->mnemonic, "OR d8");
-            break;
-        case 0xF7: /* RST 0x30 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0030;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x30");
-            break;
-        case 0xF8: /* LD HL, SP+r8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_HL;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeLDHL;
-            strcpy(instr->mnemonic, "LD HL, SP+r8");
-            break;
-        case 0xF9: /* LD SP, HL */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_HL;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_SP;
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeLD16;
-            strcpy(instr->mnemonic, "LD SP, HL");
-            break;
-        case 0xFA: /* LD A, a16 */
-            instr->instructionLength = 3;
-            instr->operandSrc.type = OP_IMM_PTR;
-            instr->operandSrc.immediate = mmu->read2Bytes(reg.read(RegID_PC) + 1);
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeLD8;
-            strcpy(instr->mnemonic, "LD A, (a16)");
-            break;
-        case 0xFB: /* EI */
-            instr->instructionLength = 1;
-            instr->cycleCost = 1;
-            instr->executionFunction = &Cpu::executeEI;
-            strcpy(instr->mnemonic, "EI");
-            break;
-        // case 0xFC: /* No instruction */
-        //     break;
-        // case 0xFD: /* No instruction */
-        //     break;
-        case 0xFE: /* CP d8 */
-            instr->instructionLength = 2;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = mmu->read(reg.read(RegID_PC) + 1);
-            instr->cycleCost = 2;
-            instr->executionFunction = &Cpu::executeCP;
-            strcpy(instr->mnemonic, "CP d8");
-            break;
-        case 0xFF: /* RST 0x38 */
-            instr->instructionLength = 1;
-            instr->operandSrc.type = OP_IMM;
-            instr->operandSrc.immediate = 0x0038;
-            instr->operandDst.type = OP_NONE;
-            instr->cycleCost = 4;
-            instr->extraInfo = COND_NONE;
-            instr->executionFunction = &Cpu::executeCALL;
-            strcpy(instr->mnemonic, "RST 0x38");
-            break;
-        default:
-            fmt::print(stderr, "Error, unsupported opcode: {:#02x}\n", opcode);
-            exit(EXIT_FAILURE);
-            break;
-    }
+    return {OP_NONE, 0, RegID_NONE, RegID_NONE};
 }
 
+constexpr operand_t opReg(RegID reg)
+{
+    return {OP_REG, 0, reg, RegID_NONE};
+}
 
-/**
- * Decoding of the prefixed opcode table. This table contains 8 bit shifts, rotations and bit
- * functions.
- */
-void Cpu::decodePrefixedOpcode(instruction_t *instr)
+constexpr operand_t opMem(RegID memPtr)
 {
-    u8 prefixedOpcode = mmu->read(reg.read(RegID_PC) + 1);
-    instr->instructionLength = 2;
-    instr->cycleCost = 2;
+    return {OP_MEM, 0, RegID_NONE, memPtr};
+}
 
-    /* Find the instruction that needs to be executed. */
-    switch(prefixedOpcode)
+constexpr operand_t opHighMem(RegID memPtr)
+{
+    return {OP_HIGH_MEM, 0, RegID_NONE, memPtr};
+}
+
+constexpr operand_t opImm(u16 immediate = 0)
+{
+    return {OP_IMM, immediate, RegID_NONE, RegID_NONE};
+}
+
+constexpr operand_t opImmPtr()
+{
+    return {OP_IMM_PTR, 0, RegID_NONE, RegID_NONE};
+}
+
+
+/**
+ * Opcode table of the unprefixed instructions. Columns: mnemonic, instruction length, cycle cost,
+ * immediate type, source operand, destination operand, extra info and execution function.
+ * Opcodes without an execution function are not supported. Opcode 0xcb selects an entry from the
+ * prefixed opcode table.
+ */
+constexpr Cpu::opcode_t Cpu::opcodeTable[256] = {
+    /* 0x00 */ {"NOP",          1, 1, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeNOP},
+    /* 0x01 */ {"LD BC, d16",   3, 3, IMM_16,     opImm(),            opReg(RegID_BC),    0,         &Cpu::executeLD16},
+    /* 0x02 */ {"LD (BC), A",   1, 2, IMM_NONE,   opReg(RegID_A),     opMem(RegID_BC),    0,         &Cpu::executeLD8},
+    /* 0x03 */ {"INC BC",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_BC),    0,         &Cpu::executeINC16},
+    /* 0x04 */ {"INC B",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_B),     0,         &Cpu::executeINC8},
+    /* 0x05 */ {"DEC B",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_B),     0,         &Cpu::executeDEC8},
+    /* 0x06 */ {"LD B, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x07 */ {"RLCA",         1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeRLCA},
+    /* 0x08 */ {"LD (a16), SP", 3, 5, IMM_16,     opReg(RegID_SP),    opImmPtr(),         0,         &Cpu::executeLD16},
+    /* 0x09 */ {"ADD HL, BC",   1, 2, IMM_NONE,   opReg(RegID_BC),    opReg(RegID_HL),    0,         &Cpu::executeADD16},
+    /* 0x0a */ {"LD A, (BC)",   1, 2, IMM_NONE,   opMem(RegID_BC),    opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x0b */ {"DEC BC",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_BC),    0,         &Cpu::executeDEC16},
+    /* 0x0c */ {"INC C",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_C),     0,         &Cpu::executeINC8},
+    /* 0x0d */ {"DEC C",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_C),     0,         &Cpu::executeDEC8},
+    /* 0x0e */ {"LD C, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x0f */ {"RRCA",         1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeRRCA},
+    /* 0x10 */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0x11 */ {"LD DE, d16",   3, 3, IMM_16,     opImm(),            opReg(RegID_DE),    0,         &Cpu::executeLD16},
+    /* 0x12 */ {"LD (DE), A",   1, 2, IMM_NONE,   opReg(RegID_A),     opMem(RegID_DE),    0,         &Cpu::executeLD8},
+    /* 0x13 */ {"INC DE",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_DE),    0,         &Cpu::executeINC16},
+    /* 0x14 */ {"INC D",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_D),     0,         &Cpu::executeINC8},
+    /* 0x15 */ {"DEC D",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_D),     0,         &Cpu::executeDEC8},
+    /* 0x16 */ {"LD D, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x17 */ {"RLA",          1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeRLA},
+    /* 0x18 */ {"JR r8",        2, 3, IMM_8,      opImm(),            opReg(RegID_PC),    COND_NONE, &Cpu::executeJR},
+    /* 0x19 */ {"ADD HL, DE",   1, 2, IMM_NONE,   opReg(RegID_DE),    opReg(RegID_HL),    0,         &Cpu::executeADD16},
+    /* 0x1a */ {"LD A, (DE)",   1, 2, IMM_NONE,   opMem(RegID_DE),    opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x1b */ {"DEC DE",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_DE),    0,         &Cpu::executeDEC16},
+    /* 0x1c */ {"INC E",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_E),     0,         &Cpu::executeINC8},
+    /* 0x1d */ {"DEC E",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_E),     0,         &Cpu::executeDEC8},
+    /* 0x1e */ {"LD E, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x1f */ {"RRA",          1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeRRA},
+    /* 0x20 */ {"JR NZ, r8",    2, 3, IMM_8,      opImm(),            opReg(RegID_PC),    COND_NZ,   &Cpu::executeJR},
+    /* 0x21 */ {"LD HL, d16",   3, 3, IMM_16,     opImm(),            opReg(RegID_HL),    0,         &Cpu::executeLD16},
+    /* 0x22 */ {"LD (HLI), A",  1, 2, IMM_NONE,   opReg(RegID_A),     opMem(RegID_HL),    0,         &Cpu::executeLD8Inc},
+    /* 0x23 */ {"INC HL",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_HL),    0,         &Cpu::executeINC16},
+    /* 0x24 */ {"INC H",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_H),     0,         &Cpu::executeINC8},
+    /* 0x25 */ {"DEC H",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_H),     0,         &Cpu::executeDEC8},
+    /* 0x26 */ {"LD H, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x27 */ {"DAA",          1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeDAA},
+    /* 0x28 */ {"JR Z, r8",     2, 3, IMM_8,      opImm(),            opReg(RegID_PC),    COND_Z,    &Cpu::executeJR},
+    /* 0x29 */ {"ADD HL, HL",   1, 2, IMM_NONE,   opReg(RegID_HL),    opReg(RegID_HL),    0,         &Cpu::executeADD16},
+    /* 0x2a */ {"LD A, (HLI)",  1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_A),     0,         &Cpu::executeLD8Inc},
+    /* 0x2b */ {"DEC HL",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_HL),    0,         &Cpu::executeDEC16},
+    /* 0x2c */ {"INC L",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_L),     0,         &Cpu::executeINC8},
+    /* 0x2d */ {"DEC L",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_L),     0,         &Cpu::executeDEC8},
+    /* 0x2e */ {"LD L, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x2f */ {"CPL",          1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeCPL},
+    /* 0x30 */ {"JR NC, r8",    2, 3, IMM_8,      opImm(),            opReg(RegID_PC),    COND_NC,   &Cpu::executeJR},
+    /* 0x31 */ {"LD SP, d16",   3, 3, IMM_16,     opImm(),            opReg(RegID_SP),    0,         &Cpu::executeLD16},
+    /* 0x32 */ {"LD (HLD), A",  1, 2, IMM_NONE,   opReg(RegID_A),     opMem(RegID_HL),    0,         &Cpu::executeLD8Dec},
+    /* 0x33 */ {"INC SP",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_SP),    0,         &Cpu::executeINC16},
+    /* 0x34 */ {"INC (HL)",     1, 3, IMM_NONE,   opNone(),           opMem(RegID_HL),    0,         &Cpu::executeINC8},
+    /* 0x35 */ {"DEC (HL)",     1, 3, IMM_NONE,   opMem(RegID_HL),    opMem(RegID_HL),    0,         &Cpu::executeDEC8},
+    /* 0x36 */ {"LD (HL), d8",  2, 3, IMM_8,      opImm(),            opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x37 */ {"SCF",          1, 1, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeSCF},
+    /* 0x38 */ {"JR C, r8",     2, 3, IMM_8,      opImm(),            opReg(RegID_PC),    COND_C,    &Cpu::executeJR},
+    /* 0x39 */ {"ADD HL, SP",   1, 2, IMM_NONE,   opReg(RegID_SP),    opReg(RegID_HL),    0,         &Cpu::executeADD16},
+    /* 0x3a */ {"LD A, (HLD)",  1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_A),     0,         &Cpu::executeLD8Dec},
+    /* 0x3b */ {"DEC SP",       1, 2, IMM_NONE,   opNone(),           opReg(RegID_SP),    0,         &Cpu::executeDEC16},
+    /* 0x3c */ {"INC A",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_A),     0,         &Cpu::executeINC8},
+    /* 0x3d */ {"DEC A",        1, 1, IMM_NONE,   opNone(),           opReg(RegID_A),     0,         &Cpu::executeDEC8},
+    /* 0x3e */ {"LD A, d8",     2, 2, IMM_8,      opImm(),            opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x3f */ {"CCF",          1, 1, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeCCF},
+    /* 0x40 */ {"LD B, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x41 */ {"LD B, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x42 */ {"LD B, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x43 */ {"LD B, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x44 */ {"LD B, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x45 */ {"LD B, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x46 */ {"LD B, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x47 */ {"LD B, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_B),     0,         &Cpu::executeLD8},
+    /* 0x48 */ {"LD C, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x49 */ {"LD C, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x4a */ {"LD C, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x4b */ {"LD C, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x4c */ {"LD C, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x4d */ {"LD C, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x4e */ {"LD C, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x4f */ {"LD C, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_C),     0,         &Cpu::executeLD8},
+    /* 0x50 */ {"LD D, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x51 */ {"LD D, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x52 */ {"LD D, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x53 */ {"LD D, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x54 */ {"LD D, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x55 */ {"LD D, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x56 */ {"LD D, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x57 */ {"LD D, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_D),     0,         &Cpu::executeLD8},
+    /* 0x58 */ {"LD E, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x59 */ {"LD E, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x5a */ {"LD E, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x5b */ {"LD E, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x5c */ {"LD E, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x5d */ {"LD E, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x5e */ {"LD E, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x5f */ {"LD E, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_E),     0,         &Cpu::executeLD8},
+    /* 0x60 */ {"LD H, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x61 */ {"LD H, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x62 */ {"LD H, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x63 */ {"LD H, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x64 */ {"LD H, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x65 */ {"LD H, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x66 */ {"LD H, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x67 */ {"LD H, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_H),     0,         &Cpu::executeLD8},
+    /* 0x68 */ {"LD L, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x69 */ {"LD L, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x6a */ {"LD L, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x6b */ {"LD L, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x6c */ {"LD L, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x6d */ {"LD L, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x6e */ {"LD L, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x6f */ {"LD L, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_L),     0,         &Cpu::executeLD8},
+    /* 0x70 */ {"LD (HL), B",   1, 2, IMM_NONE,   opReg(RegID_B),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x71 */ {"LD (HL), C",   1, 2, IMM_NONE,   opReg(RegID_C),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x72 */ {"LD (HL), D",   1, 2, IMM_NONE,   opReg(RegID_D),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x73 */ {"LD (HL), E",   1, 2, IMM_NONE,   opReg(RegID_E),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x74 */ {"LD (HL), H",   1, 2, IMM_NONE,   opReg(RegID_H),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x75 */ {"LD (HL), L",   1, 2, IMM_NONE,   opReg(RegID_L),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x76 */ {"HALT",         1, 1, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeHALT},
+    /* 0x77 */ {"LD (HL), A",   1, 2, IMM_NONE,   opReg(RegID_A),     opMem(RegID_HL),    0,         &Cpu::executeLD8},
+    /* 0x78 */ {"LD A, B",      1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x79 */ {"LD A, C",      1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x7a */ {"LD A, D",      1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x7b */ {"LD A, E",      1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x7c */ {"LD A, H",      1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x7d */ {"LD A, L",      1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x7e */ {"LD A, (HL)",   1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x7f */ {"LD A, A",      1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0x80 */ {"ADD A, B",     1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x81 */ {"ADD A, C",     1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x82 */ {"ADD A, D",     1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x83 */ {"ADD A, E",     1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x84 */ {"ADD A, H",     1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x85 */ {"ADD A, L",     1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x86 */ {"ADD A, (HL)",  1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x87 */ {"ADD A, A",     1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0x88 */ {"ADC A, B",     1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x89 */ {"ADC A, C",     1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x8a */ {"ADC A, D",     1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x8b */ {"ADC A, E",     1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x8c */ {"ADC A, H",     1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x8d */ {"ADC A, L",     1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x8e */ {"ADC A, (HL)",  1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x8f */ {"ADC A, A",     1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0x90 */ {"SUB B",        1, 1, IMM_NONE,   opReg(RegID_B),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x91 */ {"SUB C",        1, 1, IMM_NONE,   opReg(RegID_C),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x92 */ {"SUB D",        1, 1, IMM_NONE,   opReg(RegID_D),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x93 */ {"SUB E",        1, 1, IMM_NONE,   opReg(RegID_E),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x94 */ {"SUB H",        1, 1, IMM_NONE,   opReg(RegID_H),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x95 */ {"SUB L",        1, 1, IMM_NONE,   opReg(RegID_L),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x96 */ {"SUB B",        1, 2, IMM_NONE,   opMem(RegID_HL),    opNone(),           0,         &Cpu::executeSUB},
+    /* 0x97 */ {"SUB A",        1, 1, IMM_NONE,   opReg(RegID_A),     opNone(),           0,         &Cpu::executeSUB},
+    /* 0x98 */ {"SBC A, B",     1, 1, IMM_NONE,   opReg(RegID_B),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x99 */ {"SBC A, C",     1, 1, IMM_NONE,   opReg(RegID_C),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x9a */ {"SBC A, D",     1, 1, IMM_NONE,   opReg(RegID_D),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x9b */ {"SBC A, E",     1, 1, IMM_NONE,   opReg(RegID_E),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x9c */ {"SBC A, H",     1, 1, IMM_NONE,   opReg(RegID_H),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x9d */ {"SBC A, L",     1, 1, IMM_NONE,   opReg(RegID_L),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x9e */ {"SBC A, (HL)",  1, 2, IMM_NONE,   opMem(RegID_HL),    opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0x9f */ {"SBC A, A",     1, 1, IMM_NONE,   opReg(RegID_A),     opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0xa0 */ {"AND B",        1, 1, IMM_NONE,   opReg(RegID_B),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa1 */ {"AND C",        1, 1, IMM_NONE,   opReg(RegID_C),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa2 */ {"AND D",        1, 1, IMM_NONE,   opReg(RegID_D),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa3 */ {"AND E",        1, 1, IMM_NONE,   opReg(RegID_E),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa4 */ {"AND H",        1, 1, IMM_NONE,   opReg(RegID_H),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa5 */ {"AND L",        1, 1, IMM_NONE,   opReg(RegID_L),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa6 */ {"AND (HL)",     1, 2, IMM_NONE,   opMem(RegID_HL),    opNone(),           0,         &Cpu::executeAND},
+    /* 0xa7 */ {"AND A",        1, 1, IMM_NONE,   opReg(RegID_A),     opNone(),           0,         &Cpu::executeAND},
+    /* 0xa8 */ {"XOR B",        1, 1, IMM_NONE,   opReg(RegID_B),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xa9 */ {"XOR C",        1, 1, IMM_NONE,   opReg(RegID_C),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xaa */ {"XOR D",        1, 1, IMM_NONE,   opReg(RegID_D),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xab */ {"XOR E",        1, 1, IMM_NONE,   opReg(RegID_E),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xac */ {"XOR H",        1, 1, IMM_NONE,   opReg(RegID_H),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xad */ {"XOR L",        1, 1, IMM_NONE,   opReg(RegID_L),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xae */ {"XOR (HL)",     1, 2, IMM_NONE,   opMem(RegID_HL),    opNone(),           0,         &Cpu::executeXOR},
+    /* 0xaf */ {"XOR A",        1, 1, IMM_NONE,   opReg(RegID_A),     opNone(),           0,         &Cpu::executeXOR},
+    /* 0xb0 */ {"OR B",         1, 1, IMM_NONE,   opReg(RegID_B),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb1 */ {"OR C",         1, 1, IMM_NONE,   opReg(RegID_C),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb2 */ {"OR D",         1, 1, IMM_NONE,   opReg(RegID_D),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb3 */ {"OR E",         1, 1, IMM_NONE,   opReg(RegID_E),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb4 */ {"OR H",         1, 1, IMM_NONE,   opReg(RegID_H),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb5 */ {"OR L",         1, 1, IMM_NONE,   opReg(RegID_L),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb6 */ {"OR (HL)",      1, 2, IMM_NONE,   opMem(RegID_HL),    opNone(),           0,         &Cpu::executeOR},
+    /* 0xb7 */ {"OR A",         1, 1, IMM_NONE,   opReg(RegID_A),     opNone(),           0,         &Cpu::executeOR},
+    /* 0xb8 */ {"CP B",         1, 1, IMM_NONE,   opReg(RegID_B),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xb9 */ {"CP C",         1, 1, IMM_NONE,   opReg(RegID_C),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xba */ {"CP D",         1, 1, IMM_NONE,   opReg(RegID_D),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xbb */ {"CP E",         1, 1, IMM_NONE,   opReg(RegID_E),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xbc */ {"CP H",         1, 1, IMM_NONE,   opReg(RegID_H),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xbd */ {"CP L",         1, 1, IMM_NONE,   opReg(RegID_L),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xbe */ {"CP (HL)",      1, 2, IMM_NONE,   opMem(RegID_HL),    opNone(),           0,         &Cpu::executeCP},
+    /* 0xbf */ {"CP A",         1, 1, IMM_NONE,   opReg(RegID_A),     opNone(),           0,         &Cpu::executeCP},
+    /* 0xc0 */ {"RET NZ",       1, 5, IMM_NONE,   opNone(),           opNone(),           COND_NZ,   &Cpu::executeRET},
+    /* 0xc1 */ {"POP BC",       1, 3, IMM_NONE,   opMem(RegID_SP),    opReg(RegID_BC),    COND_NONE, &Cpu::executePOP},
+    /* 0xc2 */ {"JP NZ, a16",   3, 4, IMM_16,     opImm(),            opNone(),           COND_NZ,   &Cpu::executeJP},
+    /* 0xc3 */ {"JP a16",       3, 4, IMM_16,     opImm(),            opNone(),           COND_NONE, &Cpu::executeJP},
+    /* 0xc4 */ {"CALL NZ, a16", 3, 6, IMM_16,     opImm(),            opNone(),           COND_NZ,   &Cpu::executeCALL},
+    /* 0xc5 */ {"PUSH BC",      1, 4, IMM_NONE,   opReg(RegID_BC),    opMem(RegID_SP),    COND_NONE, &Cpu::executePUSH},
+    /* 0xc6 */ {"ADD A, d8",    2, 2, IMM_8,      opImm(),            opReg(RegID_A),     0,         &Cpu::executeADD8},
+    /* 0xc7 */ {"RST 0x00",     1, 4, IMM_NONE,   opImm(0x0000),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xc8 */ {"RET Z",        1, 5, IMM_NONE,   opNone(),           opNone(),           COND_Z,    &Cpu::executeRET},
+    /* 0xc9 */ {"RET",          1, 4, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeRET},
+    /* 0xca */ {"JP Z, a16",    3, 4, IMM_16,     opImm(),            opNone(),           COND_Z,    &Cpu::executeJP},
+    /* 0xcb */ {"PREFIX CB",    2, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xcc */ {"CALL Z, a16",  3, 6, IMM_16,     opImm(),            opNone(),           COND_Z,    &Cpu::executeCALL},
+    /* 0xcd */ {"CALL a16",     3, 6, IMM_16,     opImm(),            opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xce */ {"ADC A, d8",    2, 2, IMM_8,      opImm(),            opReg(RegID_A),     0,         &Cpu::executeADC},
+    /* 0xcf */ {"RST 0x08",     1, 4, IMM_NONE,   opImm(0x0008),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xd0 */ {"RET NC",       1, 5, IMM_NONE,   opNone(),           opNone(),           COND_NC,   &Cpu::executeRET},
+    /* 0xd1 */ {"POP DE",       1, 3, IMM_NONE,   opMem(RegID_SP),    opReg(RegID_DE),    COND_NONE, &Cpu::executePOP},
+    /* 0xd2 */ {"JP NC, a16",   3, 4, IMM_16,     opImm(),            opNone(),           COND_NC,   &Cpu::executeJP},
+    /* 0xd3 */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xd4 */ {"CALL NC, a16", 3, 6, IMM_16,     opImm(),            opNone(),           COND_NC,   &Cpu::executeCALL},
+    /* 0xd5 */ {"PUSH DE",      1, 4, IMM_NONE,   opReg(RegID_DE),    opMem(RegID_SP),    COND_NONE, &Cpu::executePUSH},
+    /* 0xd6 */ {"SUB d8",       2, 2, IMM_8,      opImm(),            opNone(),           0,         &Cpu::executeSUB},
+    /* 0xd7 */ {"RST 0x10",     1, 4, IMM_NONE,   opImm(0x0010),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xd8 */ {"RET C",        1, 5, IMM_NONE,   opNone(),           opNone(),           COND_C,    &Cpu::executeRET},
+    /* 0xd9 */ {"RETI",         1, 4, IMM_NONE,   opNone(),           opNone(),           COND_IE,   &Cpu::executeRET},
+    /* 0xda */ {"JP C, a16",    3, 4, IMM_16,     opImm(),            opNone(),           COND_C,    &Cpu::executeJP},
+    /* 0xdb */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xdc */ {"CALL C, a16",  3, 6, IMM_16,     opImm(),            opNone(),           COND_C,    &Cpu::executeCALL},
+    /* 0xdd */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xde */ {"SBC d8",       2, 2, IMM_8,      opImm(),            opReg(RegID_A),     0,         &Cpu::executeSBC},
+    /* 0xdf */ {"RST 0x18",     1, 4, IMM_NONE,   opImm(0x0018),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xe0 */ {"LD (a8), A",   2, 3, IMM_HIGH_8, opReg(RegID_A),     opImmPtr(),         0,         &Cpu::executeLD8},
+    /* 0xe1 */ {"POP HL",       1, 3, IMM_NONE,   opMem(RegID_SP),    opReg(RegID_HL),    COND_NONE, &Cpu::executePOP},
+    /* 0xe2 */ {"LD (C), A",    1, 2, IMM_NONE,   opReg(RegID_A),     opHighMem(RegID_C), 0,         &Cpu::executeLD8},
+    /* 0xe3 */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xe4 */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xe5 */ {"PUSH HL",      1, 4, IMM_NONE,   opReg(RegID_HL),    opMem(RegID_SP),    COND_NONE, &Cpu::executePUSH},
+    /* 0xe6 */ {"AND d8",       2, 2, IMM_8,      opImm(),            opReg(RegID_A),     COND_NONE, &Cpu::executeAND},
+    /* 0xe7 */ {"RST 0x20",     1, 4, IMM_NONE,   opImm(0x0020),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xe8 */ {"ADD SP, e",    2, 4, IMM_8,      opImm(),            opReg(RegID_SP),    0,         &Cpu::executeADD16SPe},
+    /* 0xe9 */ {"JP (HL)",      1, 1, IMM_NONE,   opReg(RegID_HL),    opNone(),           COND_HL,   &Cpu::executeJP},
+    /* 0xea */ {"LD (a16), A",  3, 4, IMM_16,     opReg(RegID_A),     opImmPtr(),         COND_NONE, &Cpu::executeLD8},
+    /* 0xeb */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xec */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xed */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xee */ {"XOR d8",       2, 2, IMM_8,      opImm(),            opNone(),           0,         &Cpu::executeXOR},
+    /* 0xef */ {"RST 0x28",     1, 4, IMM_NONE,   opImm(0x0028),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xf0 */ {"LD A, (a8)",   2, 3, IMM_HIGH_8, opImmPtr(),         opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0xf1 */ {"POP AF",       1, 3, IMM_NONE,   opMem(RegID_SP),    opReg(RegID_AF),    COND_NONE, &Cpu::executePOP},
+    /* 0xf2 */ {"LD A, (C)",    1, 2, IMM_NONE,   opHighMem(RegID_C), opReg(RegID_A),     0,         &Cpu::executeLD8},
+    /* 0xf3 */ {"DI",           1, 1, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeDI},
+    /* 0xf4 */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xf5 */ {"PUSH AF",      1, 4, IMM_NONE,   opReg(RegID_AF),    opMem(RegID_SP),    COND_NONE, &Cpu::executePUSH},
+    /* 0xf6 */ {"OR d8",        2, 2, IMM_8,      opImm(),            opNone(),           0,         &Cpu::executeOR},
+    /* 0xf7 */ {"RST 0x30",     1, 4, IMM_NONE,   opImm(0x0030),      opNone(),           COND_NONE, &Cpu::executeCALL},
+    /* 0xf8 */ {"LD HL, SP+r8", 2, 3, IMM_8,      opImm(),            opReg(RegID_HL),    0,         &Cpu::executeLDHL},
+    /* 0xf9 */ {"LD SP, HL",    1, 2, IMM_NONE,   opReg(RegID_HL),    opReg(RegID_SP),    0,         &Cpu::executeLD16},
+    /* 0xfa */ {"LD A, (a16)",  3, 4, IMM_16,     opImmPtr(),         opReg(RegID_A),     COND_NONE, &Cpu::executeLD8},
+    /* 0xfb */ {"EI",           1, 1, IMM_NONE,   opNone(),           opNone(),           0,         &Cpu::executeEI},
+    /* 0xfc */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xfd */ {"UNSUPPORTED",  0, 0, IMM_NONE,   opNone(),           opNone(),           0,         nullptr},
+    /* 0xfe */ {"CP d8",        2, 2, IMM_8,      opImm(),            opNone(),           0,         &Cpu::executeCP},
+    /* 0xff */ {"RST 0x38",     1, 4, IMM_NONE,   opImm(0x0038),      opNone(),           COND_NONE, &Cpu::executeCALL},
+};
+
+
+/**
+ * Opcode table of the 0xcb prefixed instructions. This table contains 8 bit shifts, rotations and
+ * bit functions.
+ */
+constexpr Cpu::opcode_t Cpu::prefixedOpcodeTable[256] = {
+    /* 0x00 */ {"RLC B",       2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeRLC},
+    /* 0x01 */ {"RLC C",       2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeRLC},
+    /* 0x02 */ {"RLC D",       2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeRLC},
+    /* 0x03 */ {"RLC E",       2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeRLC},
+    /* 0x04 */ {"RLC H",       2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeRLC},
+    /* 0x05 */ {"RLC L",       2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeRLC},
+    /* 0x06 */ {"RLC (HL)",    2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeRLC},
+    /* 0x07 */ {"RLC A",       2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeRLC},
+    /* 0x08 */ {"RRC B",       2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeRRC},
+    /* 0x09 */ {"RRC C",       2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeRRC},
+    /* 0x0a */ {"RRC D",       2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeRRC},
+    /* 0x0b */ {"RRC E",       2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeRRC},
+    /* 0x0c */ {"RRC H",       2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeRRC},
+    /* 0x0d */ {"RRC L",       2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeRRC},
+    /* 0x0e */ {"RRC (HL)",    2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeRRC},
+    /* 0x0f */ {"RRC A",       2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeRRC},
+    /* 0x10 */ {"RL B",        2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeRL},
+    /* 0x11 */ {"RL C",        2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeRL},
+    /* 0x12 */ {"RL D",        2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeRL},
+    /* 0x13 */ {"RL E",        2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeRL},
+    /* 0x14 */ {"RL H",        2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeRL},
+    /* 0x15 */ {"RL L",        2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeRL},
+    /* 0x16 */ {"RL (HL)",     2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeRL},
+    /* 0x17 */ {"RL A",        2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeRL},
+    /* 0x18 */ {"RR B",        2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeRR},
+    /* 0x19 */ {"RR C",        2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeRR},
+    /* 0x1a */ {"RR D",        2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeRR},
+    /* 0x1b */ {"RR E",        2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeRR},
+    /* 0x1c */ {"RR H",        2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeRR},
+    /* 0x1d */ {"RR L",        2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeRR},
+    /* 0x1e */ {"RR (HL)",     2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeRR},
+    /* 0x1f */ {"RR A",        2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeRR},
+    /* 0x20 */ {"SLA B",       2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeSLA},
+    /* 0x21 */ {"SLA C",       2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeSLA},
+    /* 0x22 */ {"SLA D",       2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeSLA},
+    /* 0x23 */ {"SLA E",       2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeSLA},
+    /* 0x24 */ {"SLA H",       2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeSLA},
+    /* 0x25 */ {"SLA L",       2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeSLA},
+    /* 0x26 */ {"SLA (HL)",    2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeSLA},
+    /* 0x27 */ {"SLA A",       2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeSLA},
+    /* 0x28 */ {"SRA B",       2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeSRA},
+    /* 0x29 */ {"SRA C",       2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeSRA},
+    /* 0x2a */ {"SRA D",       2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeSRA},
+    /* 0x2b */ {"SRA E",       2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeSRA},
+    /* 0x2c */ {"SRA H",       2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeSRA},
+    /* 0x2d */ {"SRA L",       2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeSRA},
+    /* 0x2e */ {"SRA (HL)",    2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeSRA},
+    /* 0x2f */ {"SRA A",       2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeSRA},
+    /* 0x30 */ {"SWAP B",      2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeSWAP},
+    /* 0x31 */ {"SWAP C",      2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeSWAP},
+    /* 0x32 */ {"SWAP D",      2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeSWAP},
+    /* 0x33 */ {"SWAP E",      2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeSWAP},
+    /* 0x34 */ {"SWAP H",      2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeSWAP},
+    /* 0x35 */ {"SWAP L",      2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeSWAP},
+    /* 0x36 */ {"SWAP (HL)",   2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeSWAP},
+    /* 0x37 */ {"SWAP A",      2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeSWAP},
+    /* 0x38 */ {"SRL B",       2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeSRL},
+    /* 0x39 */ {"SRL C",       2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeSRL},
+    /* 0x3a */ {"SRL D",       2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeSRL},
+    /* 0x3b */ {"SRL E",       2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeSRL},
+    /* 0x3c */ {"SRL H",       2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeSRL},
+    /* 0x3d */ {"SRL L",       2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeSRL},
+    /* 0x3e */ {"SRL (HL)",    2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeSRL},
+    /* 0x3f */ {"SRL A",       2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeSRL},
+    /* 0x40 */ {"BIT 0, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x41 */ {"BIT 0, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x42 */ {"BIT 0, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x43 */ {"BIT 0, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x44 */ {"BIT 0, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x45 */ {"BIT 0, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x46 */ {"BIT 0, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        0, &Cpu::executeBIT},
+    /* 0x47 */ {"BIT 0, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        0, &Cpu::executeBIT},
+    /* 0x48 */ {"BIT 1, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x49 */ {"BIT 1, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x4a */ {"BIT 1, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x4b */ {"BIT 1, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x4c */ {"BIT 1, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x4d */ {"BIT 1, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x4e */ {"BIT 1, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        1, &Cpu::executeBIT},
+    /* 0x4f */ {"BIT 1, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        1, &Cpu::executeBIT},
+    /* 0x50 */ {"BIT 2, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x51 */ {"BIT 2, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x52 */ {"BIT 2, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x53 */ {"BIT 2, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x54 */ {"BIT 2, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x55 */ {"BIT 2, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x56 */ {"BIT 2, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        2, &Cpu::executeBIT},
+    /* 0x57 */ {"BIT 2, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        2, &Cpu::executeBIT},
+    /* 0x58 */ {"BIT 3, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x59 */ {"BIT 3, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x5a */ {"BIT 3, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x5b */ {"BIT 3, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x5c */ {"BIT 3, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x5d */ {"BIT 3, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x5e */ {"BIT 3, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        3, &Cpu::executeBIT},
+    /* 0x5f */ {"BIT 3, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        3, &Cpu::executeBIT},
+    /* 0x60 */ {"BIT 4, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x61 */ {"BIT 4, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x62 */ {"BIT 4, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x63 */ {"BIT 4, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x64 */ {"BIT 4, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x65 */ {"BIT 4, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x66 */ {"BIT 4, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        4, &Cpu::executeBIT},
+    /* 0x67 */ {"BIT 4, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        4, &Cpu::executeBIT},
+    /* 0x68 */ {"BIT 5, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x69 */ {"BIT 5, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x6a */ {"BIT 5, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x6b */ {"BIT 5, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x6c */ {"BIT 5, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x6d */ {"BIT 5, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x6e */ {"BIT 5, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        5, &Cpu::executeBIT},
+    /* 0x6f */ {"BIT 5, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        5, &Cpu::executeBIT},
+    /* 0x70 */ {"BIT 6, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x71 */ {"BIT 6, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x72 */ {"BIT 6, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x73 */ {"BIT 6, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x74 */ {"BIT 6, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x75 */ {"BIT 6, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x76 */ {"BIT 6, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        6, &Cpu::executeBIT},
+    /* 0x77 */ {"BIT 6, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        6, &Cpu::executeBIT},
+    /* 0x78 */ {"BIT 7, B",    2, 2, IMM_NONE, opReg(RegID_B),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x79 */ {"BIT 7, C",    2, 2, IMM_NONE, opReg(RegID_C),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x7a */ {"BIT 7, D",    2, 2, IMM_NONE, opReg(RegID_D),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x7b */ {"BIT 7, E",    2, 2, IMM_NONE, opReg(RegID_E),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x7c */ {"BIT 7, H",    2, 2, IMM_NONE, opReg(RegID_H),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x7d */ {"BIT 7, L",    2, 2, IMM_NONE, opReg(RegID_L),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x7e */ {"BIT 7, (HL)", 2, 3, IMM_NONE, opMem(RegID_HL), opNone(),        7, &Cpu::executeBIT},
+    /* 0x7f */ {"BIT 7, A",    2, 2, IMM_NONE, opReg(RegID_A),  opNone(),        7, &Cpu::executeBIT},
+    /* 0x80 */ {"RES 0, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeRES},
+    /* 0x81 */ {"RES 0, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeRES},
+    /* 0x82 */ {"RES 0, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeRES},
+    /* 0x83 */ {"RES 0, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeRES},
+    /* 0x84 */ {"RES 0, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeRES},
+    /* 0x85 */ {"RES 0, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeRES},
+    /* 0x86 */ {"RES 0, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeRES},
+    /* 0x87 */ {"RES 0, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeRES},
+    /* 0x88 */ {"RES 1, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  1, &Cpu::executeRES},
+    /* 0x89 */ {"RES 1, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  1, &Cpu::executeRES},
+    /* 0x8a */ {"RES 1, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  1, &Cpu::executeRES},
+    /* 0x8b */ {"RES 1, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  1, &Cpu::executeRES},
+    /* 0x8c */ {"RES 1, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  1, &Cpu::executeRES},
+    /* 0x8d */ {"RES 1, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  1, &Cpu::executeRES},
+    /* 0x8e */ {"RES 1, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 1, &Cpu::executeRES},
+    /* 0x8f */ {"RES 1, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  1, &Cpu::executeRES},
+    /* 0x90 */ {"RES 2, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  2, &Cpu::executeRES},
+    /* 0x91 */ {"RES 2, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  2, &Cpu::executeRES},
+    /* 0x92 */ {"RES 2, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  2, &Cpu::executeRES},
+    /* 0x93 */ {"RES 2, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  2, &Cpu::executeRES},
+    /* 0x94 */ {"RES 2, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  2, &Cpu::executeRES},
+    /* 0x95 */ {"RES 2, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  2, &Cpu::executeRES},
+    /* 0x96 */ {"RES 2, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 2, &Cpu::executeRES},
+    /* 0x97 */ {"RES 2, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  2, &Cpu::executeRES},
+    /* 0x98 */ {"RES 3, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  3, &Cpu::executeRES},
+    /* 0x99 */ {"RES 3, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  3, &Cpu::executeRES},
+    /* 0x9a */ {"RES 3, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  3, &Cpu::executeRES},
+    /* 0x9b */ {"RES 3, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  3, &Cpu::executeRES},
+    /* 0x9c */ {"RES 3, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  3, &Cpu::executeRES},
+    /* 0x9d */ {"RES 3, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  3, &Cpu::executeRES},
+    /* 0x9e */ {"RES 3, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 3, &Cpu::executeRES},
+    /* 0x9f */ {"RES 3, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  3, &Cpu::executeRES},
+    /* 0xa0 */ {"RES 4, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  4, &Cpu::executeRES},
+    /* 0xa1 */ {"RES 4, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  4, &Cpu::executeRES},
+    /* 0xa2 */ {"RES 4, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  4, &Cpu::executeRES},
+    /* 0xa3 */ {"RES 4, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  4, &Cpu::executeRES},
+    /* 0xa4 */ {"RES 4, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  4, &Cpu::executeRES},
+    /* 0xa5 */ {"RES 4, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  4, &Cpu::executeRES},
+    /* 0xa6 */ {"RES 4, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 4, &Cpu::executeRES},
+    /* 0xa7 */ {"RES 4, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  4, &Cpu::executeRES},
+    /* 0xa8 */ {"RES 5, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  5, &Cpu::executeRES},
+    /* 0xa9 */ {"RES 5, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  5, &Cpu::executeRES},
+    /* 0xaa */ {"RES 5, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  5, &Cpu::executeRES},
+    /* 0xab */ {"RES 5, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  5, &Cpu::executeRES},
+    /* 0xac */ {"RES 5, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  5, &Cpu::executeRES},
+    /* 0xad */ {"RES 5, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  5, &Cpu::executeRES},
+    /* 0xae */ {"RES 5, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 5, &Cpu::executeRES},
+    /* 0xaf */ {"RES 5, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  5, &Cpu::executeRES},
+    /* 0xb0 */ {"RES 6, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  6, &Cpu::executeRES},
+    /* 0xb1 */ {"RES 6, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  6, &Cpu::executeRES},
+    /* 0xb2 */ {"RES 6, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  6, &Cpu::executeRES},
+    /* 0xb3 */ {"RES 6, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  6, &Cpu::executeRES},
+    /* 0xb4 */ {"RES 6, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  6, &Cpu::executeRES},
+    /* 0xb5 */ {"RES 6, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  6, &Cpu::executeRES},
+    /* 0xb6 */ {"RES 6, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 6, &Cpu::executeRES},
+    /* 0xb7 */ {"RES 6, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  6, &Cpu::executeRES},
+    /* 0xb8 */ {"RES 7, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  7, &Cpu::executeRES},
+    /* 0xb9 */ {"RES 7, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  7, &Cpu::executeRES},
+    /* 0xba */ {"RES 7, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  7, &Cpu::executeRES},
+    /* 0xbb */ {"RES 7, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  7, &Cpu::executeRES},
+    /* 0xbc */ {"RES 7, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  7, &Cpu::executeRES},
+    /* 0xbd */ {"RES 7, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  7, &Cpu::executeRES},
+    /* 0xbe */ {"RES 7, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 7, &Cpu::executeRES},
+    /* 0xbf */ {"RES 7, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  7, &Cpu::executeRES},
+    /* 0xc0 */ {"SET 0, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  0, &Cpu::executeSET},
+    /* 0xc1 */ {"SET 0, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  0, &Cpu::executeSET},
+    /* 0xc2 */ {"SET 0, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  0, &Cpu::executeSET},
+    /* 0xc3 */ {"SET 0, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  0, &Cpu::executeSET},
+    /* 0xc4 */ {"SET 0, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  0, &Cpu::executeSET},
+    /* 0xc5 */ {"SET 0, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  0, &Cpu::executeSET},
+    /* 0xc6 */ {"SET 0, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 0, &Cpu::executeSET},
+    /* 0xc7 */ {"SET 0, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  0, &Cpu::executeSET},
+    /* 0xc8 */ {"SET 1, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  1, &Cpu::executeSET},
+    /* 0xc9 */ {"SET 1, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  1, &Cpu::executeSET},
+    /* 0xca */ {"SET 1, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  1, &Cpu::executeSET},
+    /* 0xcb */ {"SET 1, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  1, &Cpu::executeSET},
+    /* 0xcc */ {"SET 1, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  1, &Cpu::executeSET},
+    /* 0xcd */ {"SET 1, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  1, &Cpu::executeSET},
+    /* 0xce */ {"SET 1, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 1, &Cpu::executeSET},
+    /* 0xcf */ {"SET 1, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  1, &Cpu::executeSET},
+    /* 0xd0 */ {"SET 2, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  2, &Cpu::executeSET},
+    /* 0xd1 */ {"SET 2, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  2, &Cpu::executeSET},
+    /* 0xd2 */ {"SET 2, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  2, &Cpu::executeSET},
+    /* 0xd3 */ {"SET 2, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  2, &Cpu::executeSET},
+    /* 0xd4 */ {"SET 2, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  2, &Cpu::executeSET},
+    /* 0xd5 */ {"SET 2, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  2, &Cpu::executeSET},
+    /* 0xd6 */ {"SET 2, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 2, &Cpu::executeSET},
+    /* 0xd7 */ {"SET 2, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  2, &Cpu::executeSET},
+    /* 0xd8 */ {"SET 3, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  3, &Cpu::executeSET},
+    /* 0xd9 */ {"SET 3, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  3, &Cpu::executeSET},
+    /* 0xda */ {"SET 3, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  3, &Cpu::executeSET},
+    /* 0xdb */ {"SET 3, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  3, &Cpu::executeSET},
+    /* 0xdc */ {"SET 3, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  3, &Cpu::executeSET},
+    /* 0xdd */ {"SET 3, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  3, &Cpu::executeSET},
+    /* 0xde */ {"SET 3, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 3, &Cpu::executeSET},
+    /* 0xdf */ {"SET 3, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  3, &Cpu::executeSET},
+    /* 0xe0 */ {"SET 4, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  4, &Cpu::executeSET},
+    /* 0xe1 */ {"SET 4, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  4, &Cpu::executeSET},
+    /* 0xe2 */ {"SET 4, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  4, &Cpu::executeSET},
+    /* 0xe3 */ {"SET 4, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  4, &Cpu::executeSET},
+    /* 0xe4 */ {"SET 4, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  4, &Cpu::executeSET},
+    /* 0xe5 */ {"SET 4, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  4, &Cpu::executeSET},
+    /* 0xe6 */ {"SET 4, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 4, &Cpu::executeSET},
+    /* 0xe7 */ {"SET 4, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  4, &Cpu::executeSET},
+    /* 0xe8 */ {"SET 5, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  5, &Cpu::executeSET},
+    /* 0xe9 */ {"SET 5, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  5, &Cpu::executeSET},
+    /* 0xea */ {"SET 5, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  5, &Cpu::executeSET},
+    /* 0xeb */ {"SET 5, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  5, &Cpu::executeSET},
+    /* 0xec */ {"SET 5, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  5, &Cpu::executeSET},
+    /* 0xed */ {"SET 5, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  5, &Cpu::executeSET},
+    /* 0xee */ {"SET 5, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 5, &Cpu::executeSET},
+    /* 0xef */ {"SET 5, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  5, &Cpu::executeSET},
+    /* 0xf0 */ {"SET 6, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  6, &Cpu::executeSET},
+    /* 0xf1 */ {"SET 6, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  6, &Cpu::executeSET},
+    /* 0xf2 */ {"SET 6, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  6, &Cpu::executeSET},
+    /* 0xf3 */ {"SET 6, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  6, &Cpu::executeSET},
+    /* 0xf4 */ {"SET 6, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  6, &Cpu::executeSET},
+    /* 0xf5 */ {"SET 6, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  6, &Cpu::executeSET},
+    /* 0xf6 */ {"SET 6, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 6, &Cpu::executeSET},
+    /* 0xf7 */ {"SET 6, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  6, &Cpu::executeSET},
+    /* 0xf8 */ {"SET 7, B",    2, 2, IMM_NONE, opReg(RegID_B),  opReg(RegID_B),  7, &Cpu::executeSET},
+    /* 0xf9 */ {"SET 7, C",    2, 2, IMM_NONE, opReg(RegID_C),  opReg(RegID_C),  7, &Cpu::executeSET},
+    /* 0xfa */ {"SET 7, D",    2, 2, IMM_NONE, opReg(RegID_D),  opReg(RegID_D),  7, &Cpu::executeSET},
+    /* 0xfb */ {"SET 7, E",    2, 2, IMM_NONE, opReg(RegID_E),  opReg(RegID_E),  7, &Cpu::executeSET},
+    /* 0xfc */ {"SET 7, H",    2, 2, IMM_NONE, opReg(RegID_H),  opReg(RegID_H),  7, &Cpu::executeSET},
+    /* 0xfd */ {"SET 7, L",    2, 2, IMM_NONE, opReg(RegID_L),  opReg(RegID_L),  7, &Cpu::executeSET},
+    /* 0xfe */ {"SET 7, (HL)", 2, 4, IMM_NONE, opMem(RegID_HL), opMem(RegID_HL), 7, &Cpu::executeSET},
+    /* 0xff */ {"SET 7, A",    2, 2, IMM_NONE, opReg(RegID_A),  opReg(RegID_A),  7, &Cpu::executeSET},
+};
+
+
+/**************************************
+ * Specialised handlers
+ *************************************/
+
+/**
+ * Loads an 8 bit operand. Unlike loadOperand8bits the operand type and register are known at
+ * compile time, so only the access itself remains.
+ */
+template<u8 type, regID_t id>
+u8 Cpu::loadOperand8(const operand_t* operand)
+{
+    if constexpr(type == OP_REG)
+        return reg.get<id>();
+    else if constexpr(type == OP_MEM)
+        return mmu->read(reg.get<id>());
+    else if constexpr(type == OP_HIGH_MEM)
+        return mmu->read(0xff00 + reg.get<id>());
+    else if constexpr(type == OP_IMM)
+        return operand->immediate;
+    else
     {
-        case 0x0: /* RLC B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC B");
-            break;
-        case 0x1: /* RLC C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC C");
-            break;
-        case 0x2: /* RLC D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC D");
-            break;
-        case 0x3: /* RLC E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC E");
-            break;
-        case 0x4: /* RLC H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC H");
-            break;
-        case 0x5: /* RLC L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC L");
-            break;
-        case 0x6: /* RLC (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC (HL)");
-            break;
-        case 0x7: /* RLC A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeRLC;
-            strcpy(instr->mnemonic, "RLC A");
-            break;
-        case 0x8: /* RRC B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC B");
-            break;
-        case 0x9: /* RRC C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC C");
-            break;
-        case 0xA: /* RRC D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC D");
-            break;
-        case 0xB: /* RRC E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC E");
-            break;
-        case 0xC: /* RRC H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC H");
-            break;
-        case 0xD: /* RRC L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC L");
-            break;
-        case 0xE: /* RRC (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC (HL)");
-            break;
-        case 0xF: /* RRC A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeRRC;
-            strcpy(instr->mnemonic, "RRC A");
-            break;
-        case 0x10: /* RL B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL B");
-            break;
-        case 0x11: /* RL C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL C");
-            break;
-        case 0x12: /* RL D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL D");
-            break;
-        case 0x13: /* RL E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL E");
-            break;
-        case 0x14: /* RL H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL H");
-            break;
-        case 0x15: /* RL L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL L");
-            break;
-        case 0x16: /* RL (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL (HL)");
-            break;
-        case 0x17: /* RL A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeRL;
-            strcpy(instr->mnemonic, "RL A");
-            break;
-        case 0x18: /* RR B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR B");
-            break;
-        case 0x19: /* RR C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR C");
-            break;
-        case 0x1A: /* RR D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR D");
-            break;
-        case 0x1B: /* RR E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR E");
-            break;
-        case 0x1C:/* RR H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR H");
-            break;
-        case 0x1D: /* RR L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR L");
-            break;
-        case 0x1E: /* RR (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR (HL)");
-            break;
-        case 0x1F: /* RR A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeRR;
-            strcpy(instr->mnemonic, "RR A");
-            break;
-        case 0x20: /* SLA B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA B");
-            break;
-        case 0x21: /* SLA C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA C");
-            break;
-        case 0x22: /* SLA D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA D");
-            break;
-        case 0x23: /* SLA E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA E");
-            break;
-        case 0x24: /* SLA H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA H");
-            break;
-        case 0x25: /* SLA L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA L");
-            break;
-        case 0x26: /* SLA (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA (HL)");
-            break;
-        case 0x27: /* SLA A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeSLA;
-            strcpy(instr->mnemonic, "SLA A");
-            break;
-        case 0x28: /* SRA B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA B");
-            break;
-        case 0x29: /* SRA C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA C");
-            break;
-        case 0x2A: /* SRA D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA D");
-            break;
-        case 0x2B: /* SRA E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA E");
-            break;
-        case 0x2C: /* SRA H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA H");
-            break;
-        case 0x2D: /* SRA L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA L");
-            break;
-        case 0x2E: /* SRA (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA (HL)");
-            break;
-        case 0x2F: /* SRA A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeSRA;
-            strcpy(instr->mnemonic, "SRA A");
-            break;
-        case 0x30: /* SWAP B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP B");
-            break;
-        case 0x31: /* SWAP C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP C");
-            break;
-        case 0x32: /* SWAP D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP D");
-            break;
-        case 0x33: /* SWAP E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP E");
-            break;
-        case 0x34: /* SWAP H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP H");
-            break;
-        case 0x35: /* SWAP L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP L");
-            break;
-        case 0x36: /* SWAP (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP (HL)");
-            break;
-        case 0x37: /* SWAP A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeSWAP;
-            strcpy(instr->mnemonic, "SWAP A");
-            break;
-        case 0x38: /* SRL B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL B");
-            break;
-        case 0x39: /* SRL C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL C");
-            break;
-        case 0x3A: /* SRL D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL D");
-            break;
-        case 0x3B: /* SRL E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL E");
-            break;
-        case 0x3C: /* SRL H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL H");
-            break;
-        case 0x3D: /* SRL L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL L");
-            break;
-        case 0x3E: /* SRL (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL (HL)");
-            break;
-        case 0x3F: /* SRL A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->executionFunction = &Cpu::executeSRL;
-            strcpy(instr->mnemonic, "SRL A");
-            break;
-        case 0x40: /* BIT 0, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, B");
-            break;
-        case 0x41: /* BIT 0, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, C");
-            break;
-        case 0x42: /* BIT 0, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, D");
-            break;
-        case 0x43: /* BIT 0, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, E");
-            break;
-        case 0x44: /* BIT 0, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, H");
-            break;
-        case 0x45: /* BIT 0, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, L");
-            break;
-        case 0x46: /* BIT 0, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 0;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, (HL)");
-            break;
-        case 0x47: /* BIT 0, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 0, A");
-            break;
-        case 0x48: /* BIT 1, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, B");
-            break;
-        case 0x49: /* BIT 1, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, C");
-            break;
-        case 0x4A: /* BIT 1, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, D");
-            break;
-        case 0x4B: /* BIT 1, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, E");
-            break;
-        case 0x4C: /* BIT 1, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, H");
-            break;
-        case 0x4D: /* BIT 1, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, L");
-            break;
-        case 0x4E: /* BIT 1 (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 1;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, (HL)");
-            break;
-        case 0x4F: /* BIT 1, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 1, A");
-            break;
-        case 0x50: /* BIT 2, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, B");
-            break;
-        case 0x51: /* BIT 2, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, C");
-            break;
-        case 0x52: /* BIT 2, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, D");
-            break;
-        case 0x53: /* BIT 2, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, E");
-            break;
-        case 0x54: /* BIT 2, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, H");
-            break;
-        case 0x55: /* BIT 2, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, L");
-            break;
-        case 0x56: /* BIT 2, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 2;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, (HL)");
-            break;
-        case 0x57: /* BIT 2, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 2, A");
-            break;
-        case 0x58: /* BIT 3, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, B");
-            break;
-        case 0x59: /* BIT 3, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, C");
-            break;
-        case 0x5A: /* BIT 3, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, D");
-            break;
-        case 0x5B: /* BIT 3, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, E");
-            break;
-        case 0x5C: /* BIT 3, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, H");
-            break;
-        case 0x5D: /* BIT 3, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, L");
-            break;
-        case 0x5E: /* BIT 3, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 3;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, (HL)");
-            break;
-        case 0x5F: /* BIT 3, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 3, A");
-            break;
-        case 0x60: /* BIT 4, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, B");
-            break;
-        case 0x61: /* BIT 4, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, C");
-            break;
-        case 0x62: /* BIT 4, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, D");
-            break;
-        case 0x63: /* BIT 4, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, E");
-            break;
-        case 0x64: /* BIT 4, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, H");
-            break;
-        case 0x65: /* BIT 4, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, L");
-            break;
-        case 0x66: /* BIT 4, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 4;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, (HL)");
-            break;
-        case 0x67: /* BIT 4, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 4, A");
-            break;
-        case 0x68: /* BIT 5, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, B");
-            break;
-        case 0x69: /* BIT 5, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, C");
-            break;
-        case 0x6A: /* BIT 5, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, D");
-            break;
-        case 0x6B: /* BIT 5, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, E");
-            break;
-        case 0x6C: /* BIT 5, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, H");
-            break;
-        case 0x6D: /* BIT 5, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, L");
-            break;
-        case 0x6E: /* BIT 5, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 5;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, (HL)");
-            break;
-        case 0x6F: /* BIT 5, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 5, A");
-            break;
-        case 0x70: /* BIT 6, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, B");
-            break;
-        case 0x71: /* BIT 6, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, C");
-            break;
-        case 0x72: /* BIT 6, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, D");
-            break;
-        case 0x73: /* BIT 6, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, E");
-            break;
-        case 0x74: /* BIT 6, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, H");
-            break;
-        case 0x75: /* BIT 6, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, L");
-            break;
-        case 0x76: /* BIT 6 (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 6;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, (HL)");
-            break;
-        case 0x77: /* BIT 6, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 6, A");
-            break;
-        case 0x78: /* BIT 7, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, B");
-            break;
-        case 0x79: /* BIT 7, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, C");
-            break;
-        case 0x7A: /* BIT 7, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, D");
-            break;
-        case 0x7B: /* BIT 7, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, E");
-            break;
-        case 0x7C: /* BIT 7, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, H");
-            break;
-        case 0x7D: /* BIT 7, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, L");
-            break;
-        case 0x7E: /* BIT 7, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->extraInfo = 7;
-            instr->cycleCost = 3;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, (HL)");
-            break;
-        case 0x7F: /* BIT 7, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeBIT;
-            strcpy(instr->mnemonic, "BIT 7, A");
-            break;
-        case 0x80: /* RES 0, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, B");
-            break;
-        case 0x81: /* RES 0, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, C");
-            break;
-        case 0x82: /* RES 0, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, D");
-            break;
-        case 0x83: /* RES 0, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, E");
-            break;
-        case 0x84: /* RES 0, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, H");
-            break;
-        case 0x85: /* RES 0, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, L");
-            break;
-        case 0x86: /* RES 0, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 0;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, (HL)");
-            break;
-        case 0x87: /* RES 0, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 0, A");
-            break;
-        case 0x88: /* RES 1, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, B");
-            break;
-        case 0x89: /* RES 1, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, C");
-            break;
-        case 0x8A: /* RES 1, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, D");
-            break;
-        case 0x8B: /* RES 1, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, E");
-            break;
-        case 0x8C: /* RES 1, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, H");
-            break;
-        case 0x8D: /* RES 1, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, L");
-            break;
-        case 0x8E: /* RES 1 (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 1;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, (HL)");
-            break;
-        case 0x8F: /* RES 1, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 1, A");
-            break;
-        case 0x90: /* RES 2, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, B");
-            break;
-        case 0x91: /* RES 2, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, C");
-            break;
-        case 0x92: /* RES 2, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, D");
-            break;
-        case 0x93: /* RES 2, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, E");
-            break;
-        case 0x94: /* RES 2, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, H");
-            break;
-        case 0x95: /* RES 2, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, L");
-            break;
-        case 0x96: /* RES 2, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 2;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, (HL)");
-            break;
-        case 0x97: /* RES 2, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 2, A");
-            break;
-        case 0x98: /* RES 3, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, B");
-            break;
-        case 0x99: /* RES 3, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, C");
-            break;
-        case 0x9A: /* RES 3, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, D");
-            break;
-        case 0x9B: /* RES 3, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, E");
-            break;
-        case 0x9C: /* RES 3, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, H");
-            break;
-        case 0x9D: /* RES 3, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, L");
-            break;
-        case 0x9E: /* RES 3, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 3;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, (HL)");
-            break;
-        case 0x9F: /* RES 3, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 3, A");
-            break;
-        case 0xA0: /* RES 4, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, B");
-            break;
-        case 0xA1: /* RES 4, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, C");
-            break;
-        case 0xA2: /* RES 4, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, D");
-            break;
-        case 0xA3: /* RES 4, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, E");
-            break;
-        case 0xA4: /* RES 4, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, H");
-            break;
-        case 0xA5: /* RES 4, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, L");
-            break;
-        case 0xA6: /* RES 4, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 4;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, (HL)");
-            break;
-        case 0xA7: /* RES 4, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 4, A");
-            break;
-        case 0xA8: /* RES 5, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, B");
-            break;
-        case 0xA9: /* RES 5, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, C");
-            break;
-        case 0xAA: /* RES 5, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, D");
-            break;
-        case 0xAB: /* RES 5, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, E");
-            break;
-        case 0xAC: /* RES 5, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, H");
-            break;
-        case 0xAD: /* RES 5, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, L");
-            break;
-        case 0xAE: /* RES 5, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 5;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, (HL)");
-            break;
-        case 0xAF: /* RES 5, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 5, A");
-            break;
-        case 0xB0: /* RES 6, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, B");
-            break;
-        case 0xB1: /* RES 6, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, C");
-            break;
-        case 0xB2: /* RES 6, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, D");
-            break;
-        case 0xB3: /* RES 6, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, E");
-            break;
-        case 0xB4: /* RES 6, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, H");
-            break;
-        case 0xB5: /* RES 6, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, L");
-            break;
-        case 0xB6: /* RES 6 (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 6;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, (HL)");
-            break;
-        case 0xB7: /* RES 6, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 6, A");
-            break;
-        case 0xB8: /* RES 7, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, B");
-            break;
-        case 0xB9: /* RES 7, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, C");
-            break;
-        case 0xBA: /* RES 7, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, D");
-            break;
-        case 0xBB: /* RES 7, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, E");
-            break;
-        case 0xBC: /* RES 7, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, H");
-            break;
-        case 0xBD: /* RES 7, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, L");
-            break;
-        case 0xBE: /* RES 7, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 7;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, (HL)");
-            break;
-        case 0xBF: /* RES 7, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeRES;
-            strcpy(instr->mnemonic, "RES 7, A");
-            break;
-        case 0xC0: /* SET 0, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, B");
-            break;
-        case 0xC1: /* SET 0, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, C");
-            break;
-        case 0xC2: /* SET 0, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, D");
-            break;
-        case 0xC3: /* SET 0, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, E");
-            break;
-        case 0xC4: /* SET 0, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, H");
-            break;
-        case 0xC5: /* SET 0, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, L");
-            break;
-        case 0xC6: /* SET 0, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 0;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, (HL)");
-            break;
-        case 0xC7: /* SET 0, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 0;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 0, A");
-            break;
-        case 0xC8: /* SET 1, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, B");
-            break;
-        case 0xC9: /* SET 1, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, C");
-            break;
-        case 0xCA: /* SET 1, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, D");
-            break;
-        case 0xCB: /* SET 1, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, E");
-            break;
-        case 0xCC: /* SET 1, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, H");
-            break;
-        case 0xCD: /* SET 1, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, L");
-            break;
-        case 0xCE: /* SET 1 (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 1;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, (HL)");
-            break;
-        case 0xCF: /* SET 1, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 1;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 1, A");
-            break;
-        case 0xD0: /* SET 2, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, B");
-            break;
-        case 0xD1: /* SET 2, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, C");
-            break;
-        case 0xD2: /* SET 2, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, D");
-            break;
-        case 0xD3: /* SET 2, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, E");
-            break;
-        case 0xD4: /* SET 2, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, H");
-            break;
-        case 0xD5: /* SET 2, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, L");
-            break;
-        case 0xD6: /* SET 2, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 2;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, (HL)");
-            break;
-        case 0xD7: /* SET 2, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 2;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 2, A");
-            break;
-        case 0xD8: /* SET 3, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, B");
-            break;
-        case 0xD9: /* SET 3, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, C");
-            break;
-        case 0xDA: /* SET 3, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, D");
-            break;
-        case 0xDB: /* SET 3, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, E");
-            break;
-        case 0xDC: /* SET 3, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, H");
-            break;
-        case 0xDD: /* SET 3, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, L");
-            break;
-        case 0xDE: /* SET 3, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 3;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, (HL)");
-            break;
-        case 0xDF: /* SET 3, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 3;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 3, A");
-            break;
-        case 0xE0: /* SET 4, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, B");
-            break;
-        case 0xE1: /* SET 4, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, C");
-            break;
-        case 0xE2: /* SET 4, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, D");
-            break;
-        case 0xE3: /* SET 4, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, E");
-            break;
-        case 0xE4: /* SET 4, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, H");
-            break;
-        case 0xE5: /* SET 4, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, L");
-            break;
-        case 0xE6: /* SET 4, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 4;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, (HL)");
-            break;
-        case 0xE7: /* SET 4, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 4, A");
-            break;
-        case 0xE8: /* SET 5, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, B");
-            break;
-        case 0xE9: /* SET 5, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, C");
-            break;
-        case 0xEA: /* SET 5, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, D");
-            break;
-        case 0xEB: /* SET 5, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, E");
-            break;
-        case 0xEC: /* SET 5, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, H");
-            break;
-        case 0xED: /* SET 5, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, L");
-            break;
-        case 0xEE: /* SET 5, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 5;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, (HL)");
-            break;
-        case 0xEF: /* SET 5, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 5;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 5, A");
-            break;
-        case 0xF0: /* SET 6, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, B");
-            break;
-        case 0xF1: /* SET 6, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, C");
-            break;
-        case 0xF2: /* SET 6, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, D");
-            break;
-        case 0xF3: /* SET 6, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, E");
-            break;
-        case 0xF4: /* SET 6, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, H");
-            break;
-        case 0xF5: /* SET 6, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, L");
-            break;
-        case 0xF6: /* SET 6 (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 6;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, (HL)");
-            break;
-        case 0xF7: /* SET 6, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 6;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 6, A");
-            break;
-        case 0xF8: /* SET 7, B */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_B;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_B;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, B");
-            break;
-        case 0xF9: /* SET 7, C */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_C;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_C;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, C");
-            break;
-        case 0xFA: /* SET 7, D */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_D;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_D;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, D");
-            break;
-        case 0xFB: /* SET 7, E */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_E;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_E;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, E");
-            break;
-        case 0xFC: /* SET 7, H */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_H;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_H;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, H");
-            break;
-        case 0xFD: /* SET 7, L */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_L;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_L;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, L");
+        static_assert(type == OP_IMM_PTR, "Unsupported 8 bit load operand");
+        return mmu->read(operand->immediate);
+    }
+}
+
+
+template<u8 type, regID_t id>
+void Cpu::storeOperand8(const operand_t* operand, u8 value)
+{
+    if constexpr(type == OP_REG)
+        reg.set<id>(value);
+    else if constexpr(type == OP_MEM)
+        mmu->write(reg.get<id>(), value);
+    else if constexpr(type == OP_HIGH_MEM)
+        mmu->write(0xff00 + reg.get<id>(), value);
+    else
+    {
+        static_assert(type == OP_IMM_PTR, "Unsupported 8 bit store operand");
+        mmu->write(operand->immediate, value);
+    }
+}
+
+
+template<u8 srcType, regID_t src, u8 dstType, regID_t dst>
+void Cpu::specialisedLD8(instruction_t* instr)
+{
+    storeOperand8<dstType, dst>(&instr->operandDst, loadOperand8<srcType, src>(&instr->operandSrc));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedADD8(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluAdd(param, reg.get<RegID_A>(), false));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedADC(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluAdd(param, reg.get<RegID_A>(), reg.getFlagCarry()));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedSUB(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluSub(reg.get<RegID_A>(), param, false));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedSBC(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluSub(reg.get<RegID_A>(), param, reg.getFlagCarry()));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedAND(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluAnd(reg.get<RegID_A>(), param));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedXOR(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluXor(reg.get<RegID_A>(), param));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedOR(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    reg.set<RegID_A>(aluOr(reg.get<RegID_A>(), param));
+}
+
+
+template<u8 srcType, regID_t src>
+void Cpu::specialisedCP(instruction_t* instr)
+{
+    u8 param = loadOperand8<srcType, src>(&instr->operandSrc);
+    aluSub(reg.get<RegID_A>(), param, false);
+}
+
+
+template<u8 dstType, regID_t dst>
+void Cpu::specialisedINC8(instruction_t* instr)
+{
+    u8 param = loadOperand8<dstType, dst>(&instr->operandDst);
+    storeOperand8<dstType, dst>(&instr->operandDst, aluInc(param));
+}
+
+
+template<u8 dstType, regID_t dst>
+void Cpu::specialisedDEC8(instruction_t* instr)
+{
+    u8 param = loadOperand8<dstType, dst>(&instr->operandDst);
+    storeOperand8<dstType, dst>(&instr->operandDst, aluDec(param));
+}
+
+
+template<regID_t dst>
+void Cpu::specialisedINC16(instruction_t*)
+{
+    reg.set<dst>(reg.get<dst>() + 1);
+}
+
+
+template<regID_t dst>
+void Cpu::specialisedDEC16(instruction_t*)
+{
+    reg.set<dst>(reg.get<dst>() - 1);
+}
+
+
+/* Register used by an operand, the memory pointer for memory operands. */
+constexpr regID_t operandRegister(const operand_t& operand)
+{
+    return operand.type == OP_REG ? operand.reg : operand.memPtr;
+}
+
+
+/**
+ * Selects the specialised handler of an unprefixed opcode by matching the generic handler and the
+ * operands in the opcode table. Returns nullptr for opcodes that only have a generic handler.
+ */
+template<u8 opcode>
+constexpr Cpu::handler_t Cpu::selectSpecialisedHandler()
+{
+    constexpr opcode_t op = opcodeTable[opcode];
+    constexpr u8 srcType = op.operandSrc.type;
+    constexpr regID_t src = operandRegister(op.operandSrc);
+    constexpr u8 dstType = op.operandDst.type;
+    constexpr regID_t dst = operandRegister(op.operandDst);
+    constexpr bool dstIsA = dstType == OP_REG && dst == RegID_A;
+
+    if constexpr(op.executionFunction == &Cpu::executeLD8)
+        return &Cpu::specialisedLD8<srcType, src, dstType, dst>;
+    else if constexpr(op.executionFunction == &Cpu::executeADD8 && dstIsA)
+        return &Cpu::specialisedADD8<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeADC && dstIsA)
+        return &Cpu::specialisedADC<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeSUB)
+        return &Cpu::specialisedSUB<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeSBC)
+        return &Cpu::specialisedSBC<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeAND)
+        return &Cpu::specialisedAND<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeXOR)
+        return &Cpu::specialisedXOR<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeOR)
+        return &Cpu::specialisedOR<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeCP)
+        return &Cpu::specialisedCP<srcType, src>;
+    else if constexpr(op.executionFunction == &Cpu::executeINC8)
+        return &Cpu::specialisedINC8<dstType, dst>;
+    else if constexpr(op.executionFunction == &Cpu::executeDEC8)
+        return &Cpu::specialisedDEC8<dstType, dst>;
+    else if constexpr(op.executionFunction == &Cpu::executeINC16 && dstType == OP_REG)
+        return &Cpu::specialisedINC16<dst>;
+    else if constexpr(op.executionFunction == &Cpu::executeDEC16 && dstType == OP_REG)
+        return &Cpu::specialisedDEC16<dst>;
+    else
+        return nullptr;
+}
+
+
+template<std::size_t... opcodes>
+constexpr std::array<Cpu::handler_t, 256> Cpu::makeSpecialisedHandlers(std::index_sequence<opcodes...>)
+{
+    return {{selectSpecialisedHandler<opcodes>()...}};
+}
+
+
+/**
+ * Specialised handlers of the unprefixed opcodes, generated from the opcode table.
+ */
+constexpr std::array<Cpu::handler_t, 256> Cpu::specialisedOpcodeHandlers =
+    Cpu::makeSpecialisedHandlers(std::make_index_sequence<256>());
+
+
+/**
+ * Decodes an opcode by copying its entry from the opcode tables into the instruction and fetching
+ * the immediate value that follows the opcode.
+ */
+void Cpu::decodeOpcode(instruction_t *instr, u8 opcode)
+{
+    /* Read the instruction bytes straight from memory when the instruction can not cross a page,
+     * otherwise fall back to reading every byte through the Mmu. */
+    u16 location = instr->memoryLocation;
+    const u8* code = mmu->fetch(location, 3);
+
+    const opcode_t* op = &opcodeTable[opcode];
+    if(opcode == 0xcb)
+        op = &prefixedOpcodeTable[code != nullptr ? code[1] : mmu->read(location + 1)];
+
+    if(op->executionFunction == nullptr)
+    {
+        fmt::print(stderr, "Error, unsupported opcode: {:#02x}\n", opcode);
+        exit(EXIT_FAILURE);
+    }
+
+    instr->instructionLength = op->instructionLength;
+    instr->mnemonic = op->mnemonic;
+    instr->operandSrc = op->operandSrc;
+    instr->operandDst = op->operandDst;
+    instr->cycleCost = op->cycleCost;
+    instr->extraInfo = op->extraInfo;
+    instr->executionFunction = op->executionFunction;
+    if(this->specialisedHandlers && opcode != 0xcb && specialisedOpcodeHandlers[opcode] != nullptr)
+        instr->executionFunction = specialisedOpcodeHandlers[opcode];
+
+    /* The immediate value belongs to the source operand unless only the destination uses one. */
+    operand_t* operand = &instr->operandSrc;
+    if(operand->type != OP_IMM && operand->type != OP_IMM_PTR)
+        operand = &instr->operandDst;
+
+    switch(op->immediateType)
+    {
+        case IMM_8:
+            operand->immediate = code != nullptr ? code[1] : mmu->read(location + 1);
             break;
-        case 0xFE: /* SET 7, (HL) */
-            instr->operandSrc.type = OP_MEM;
-            instr->operandSrc.memPtr = RegID_HL;
-            instr->operandDst.type = OP_MEM;
-            instr->operandDst.memPtr = RegID_HL;
-            instr->extraInfo = 7;
-            instr->cycleCost = 4;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, (HL)");
+        case IMM_16:
+            operand->immediate = code != nullptr ? code[1] | (code[2] << 8) : mmu->read2Bytes(location + 1);
             break;
-        case 0xFF: /* SET 7, A */
-            instr->operandSrc.type = OP_REG;
-            instr->operandSrc.reg = RegID_A;
-            instr->operandDst.type = OP_REG;
-            instr->operandDst.reg = RegID_A;
-            instr->extraInfo = 7;
-            instr->executionFunction = &Cpu::executeSET;
-            strcpy(instr->mnemonic, "SET 7, A");
+        case IMM_HIGH_8:
+            operand->immediate = (code != nullptr ? code[1] : mmu->read(location + 1)) + 0xff00;
             break;
+        case IMM_NONE:
         default:
-            fmt::print(stderr, "Error, unsupported prefixed opcode: cb {:02x}\n", prefixedOpcode);
-            exit(EXIT_FAILURE);
             break;
     }
 }
@@ -0,0 +1,291 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "polarGB/rewind_buffer.h"
+
+
+using namespace std;
+
+
+/* Equal bytes that are needed to end a run of literal bytes, shorter runs are cheaper to store as
+ * literals. */
+const size_t MIN_ZERO_RUN = 8;
+
+
+RewindBuffer::RewindBuffer(size_t capacity, u32 keyframeInterval)
+{
+    this->capacity = capacity;
+    this->keyframeInterval = max<u32>(1, keyframeInterval);
+    this->memoryUsage = 0;
+    this->keyframeValid = false;
+    this->deltasSinceKeyframe = 0;
+}
+
+
+RewindBuffer::~RewindBuffer()
+{
+}
+
+
+/**
+ * Stores a snapshot of a save state. When the capacity is exceeded the oldest snapshots are
+ * dropped.
+ */
+void RewindBuffer::record(const vector<u8>& state)
+{
+    bool newKeyframe = !this->keyframeValid || this->keyframe.size() != state.size() ||
+        this->deltasSinceKeyframe + 1 >= this->keyframeInterval;
+
+    if(newKeyframe)
+    {
+        push(true, state, vector<u8>(state.size(), 0));
+        this->keyframe = state;
+        this->keyframeValid = true;
+        this->deltasSinceKeyframe = 0;
+    }
+    else
+    {
+        push(false, state, this->keyframe);
+        this->deltasSinceKeyframe++;
+    }
+
+    while(this->memoryUsage > this->capacity && !this->snapshots.empty())
+        dropOldest();
+}
+
+
+/**
+ * Removes the newest snapshot and restores its save state. Returns false if there are no
+ * snapshots.
+ */
+bool RewindBuffer::pop(vector<u8>& state)
+{
+    if(this->snapshots.empty())
+        return false;
+
+    snapshot_t& snapshot = this->snapshots.back();
+    if(snapshot.keyframe)
+        decode(snapshot.data, vector<u8>(), state);
+    else
+    {
+        if(!this->keyframeValid && !loadNewestKeyframe())
+            return false;
+        decode(snapshot.data, this->keyframe, state);
+    }
+
+    this->memoryUsage -= snapshot.data.size();
+    bool wasKeyframe = snapshot.keyframe;
+    this->snapshots.pop_back();
+
+    /* The next snapshot is compared with the keyframe before this one. */
+    if(wasKeyframe)
+        this->keyframeValid = false;
+    else if(this->deltasSinceKeyframe > 0)
+        this->deltasSinceKeyframe--;
+
+    return true;
+}
+
+
+void RewindBuffer::clear()
+{
+    this->snapshots.clear();
+    this->memoryUsage = 0;
+    this->keyframe.clear();
+    this->keyframeValid = false;
+    this->deltasSinceKeyframe = 0;
+}
+
+
+size_t RewindBuffer::getSnapshotCount() const
+{
+    return this->snapshots.size();
+}
+
+
+/**
+ * Returns the bytes used by the compressed snapshots.
+ */
+size_t RewindBuffer::getMemoryUsage() const
+{
+    return this->memoryUsage;
+}
+
+
+size_t RewindBuffer::getCapacity() const
+{
+    return this->capacity;
+}
+
+
+void RewindBuffer::push(bool keyframe, const vector<u8>& state, const vector<u8>& reference)
+{
+    encode(state, reference, this->encodeBuffer);
+
+    snapshot_t snapshot;
+    snapshot.keyframe = keyframe;
+    snapshot.data.assign(this->encodeBuffer.begin(), this->encodeBuffer.end());
+    this->memoryUsage += snapshot.data.size();
+    this->snapshots.push_back(move(snapshot));
+}
+
+
+/**
+ * Drops the oldest keyframe together with the differences that depend on it.
+ */
+void RewindBuffer::dropOldest()
+{
+    do
+    {
+        this->memoryUsage -= this->snapshots.front().data.size();
+        this->snapshots.pop_front();
+    }
+    while(!this->snapshots.empty() && !this->snapshots.front().keyframe);
+
+    if(this->snapshots.empty())
+    {
+        this->keyframeValid = false;
+        this->deltasSinceKeyframe = 0;
+    }
+}
+
+
+/**
+ * Decodes the newest keyframe that is left after rewinding past a keyframe.
+ */
+bool RewindBuffer::loadNewestKeyframe()
+{
+    auto snapshot = find_if(this->snapshots.rbegin(), this->snapshots.rend(),
+        [](const snapshot_t& s) { return s.keyframe; });
+    if(snapshot == this->snapshots.rend())
+        return false;
+
+    decode(snapshot->data, vector<u8>(), this->keyframe);
+    this->keyframeValid = true;
+    this->deltasSinceKeyframe = snapshot - this->snapshots.rbegin();
+    return true;
+}
+
+
+static void writeLength(vector<u8>& data, size_t length)
+{
+    while(length >= 0x80)
+    {
+        data.push_back((length & 0x7f) | 0x80);
+        length >>= 7;
+    }
+    data.push_back(length);
+}
+
+
+static size_t readLength(const vector<u8>& data, size_t& position)
+{
+    size_t length = 0;
+    for(int shift = 0; position < data.size(); shift += 7)
+    {
+        u8 byte = data[position++];
+        length |= (size_t)(byte & 0x7f) << shift;
+        if((byte & 0x80) == 0)
+            return length;
+    }
+
+    throw runtime_error("Rewind snapshot is truncated");
+}
+
+
+static bool equalWord(const u8* a, const u8* b)
+{
+    u64 first, second;
+    memcpy(&first, a, sizeof(u64));
+    memcpy(&second, b, sizeof(u64));
+    return first == second;
+}
+
+
+/**
+ * Compresses the XOR difference between a state and a reference of the same size. The data is a
+ * sequence of a zero run length, a literal length and the literal XOR bytes.
+ */
+void RewindBuffer::encode(const vector<u8>& state, const vector<u8>& reference, vector<u8>& data)
+{
+    const u8* current = state.data();
+    const u8* previous = reference.data();
+    size_t size = state.size();
+
+    data.clear();
+    writeLength(data, size);
+
+    size_t i = 0;
+    while(i < size)
+    {
+        /* Equal bytes, compared a word at a time. */
+        size_t runStart = i;
+        while(i + sizeof(u64) <= size && equalWord(current + i, previous + i))
+            i += sizeof(u64);
+        while(i < size && current[i] == previous[i])
+            i++;
+
+        /* Differing bytes, up to the next run of equal bytes that is worth encoding. */
+        size_t literalStart = i;
+        while(i < size)
+        {
+            if(i + MIN_ZERO_RUN <= size && equalWord(current + i, previous + i))
+                break;
+            i++;
+        }
+
+        writeLength(data, literalStart - runStart);
+        writeLength(data, i - literalStart);
+        for(size_t j = literalStart; j < i; j++)
+            data.push_back(current[j] ^ previous[j]);
+    }
+}
+
+
+/**
+ * Restores a state from its compressed difference with a reference. An empty reference is
+ * treated as all zeros, which is how keyframes are stored.
+ */
+void RewindBuffer::decode(const vector<u8>& data, const vector<u8>& reference, vector<u8>& state)
+{
+    size_t position = 0;
+    size_t size = readLength(data, position);
+    if(!reference.empty() && reference.size() != size)
+        throw runtime_error("Rewind snapshot does not match its keyframe");
+
+    if(reference.empty())
+        state.assign(size, 0);
+    else
+        state = reference;
+
+    size_t i = 0;
+    while(i < size)
+    {
+        i += readLength(data, position);
+        size_t literalLength = readLength(data, position);
+        if(i + literalLength > size || position + literalLength > data.size())
+            throw runtime_error("Rewind snapshot is corrupt");
+
+        for(size_t j = 0; j < literalLength; j++)
+            state[i + j] ^= data[position + j];
+        i += literalLength;
+        position += literalLength;
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <fcntl.h>
+#include <mutex>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <fmt/format.h>
+#include "polarGB/rom_image.h"
+
+
+using namespace std;
+
+
+/* Images that are currently in use, keyed by the hash of their contents. */
+static mutex registryMutex;
+static unordered_map<u64, weak_ptr<const RomImage>> registry;
+
+
+RomImage::RomImage(const u8* mem, size_t length, u64 contentHash)
+{
+    this->mem = mem;
+    this->length = length;
+    this->contentHash = contentHash;
+}
+
+
+RomImage::~RomImage()
+{
+    munmap((void *)this->mem, this->length);
+}
+
+
+/**
+ * Maps a ROM file into memory. When an image with the same contents is already mapped, the new
+ * mapping is dropped and the existing image is returned. Images with the same hash but different
+ * contents are kept apart, the newest one is registered.
+ */
+shared_ptr<const RomImage> RomImage::open(const string& fileName)
+{
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        throw std::runtime_error(
+            fmt::format("Could not open file: '{}'", fileName)
+        );
+    }
+
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        throw std::runtime_error(
+            fmt::format("Could not read file: '{}'", fileName)
+        );
+    }
+
+    size_t length = fileStat.st_size;
+    void* mem = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mem == MAP_FAILED)
+    {
+        throw std::runtime_error(
+            fmt::format("Could not map file: '{}'", fileName)
+        );
+    }
+
+    u64 contentHash = hashContents((const u8 *)mem, length);
+
+    lock_guard<mutex> lock(registryMutex);
+    auto it = registry.find(contentHash);
+    if(it != registry.end())
+    {
+        /* A hash collision must not run the code of another ROM, so the contents are compared. */
+        shared_ptr<const RomImage> image = it->second.lock();
+        if(image != nullptr && image->size() == length && memcmp(image->data(), mem, length) == 0)
+        {
+            munmap(mem, length);
+            return image;
+        }
+    }
+
+    /* Drop the entries of images that are no longer used. */
+    for(auto entry = registry.begin(); entry != registry.end();)
+    {
+        if(entry->second.expired())
+            entry = registry.erase(entry);
+        else
+            entry++;
+    }
+
+    shared_ptr<const RomImage> image(new RomImage((const u8 *)mem, length, contentHash));
+    registry[contentHash] = image;
+    return image;
+}
+
+
+/**
+ * 64-bit FNV-1a hash.
+ */
+u64 RomImage::hashContents(const u8* mem, size_t length)
+{
+    u64 hash = 0xcbf29ce484222325;
+    for(size_t i = 0; i < length; i++)
+    {
+        hash ^= mem[i];
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
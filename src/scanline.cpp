@@ -0,0 +1,165 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "polarGB/scanline.h"
+
+#ifdef SCANLINE_X86
+#include <immintrin.h>
+#endif
+
+
+/* Gray levels of the 4 DMG colours, from white to black. */
+static const u8 DMG_COLORS[4] = {0xff, 0xaa, 0x55, 0x00};
+
+
+/**
+ * Builds the colours of the 3 palettes for a line. The shade index s of a palette register is
+ * mapped to the colour in bits 2s-2s+1.
+ */
+linePalette_t makeLinePalette(u8 bgp, u8 obp0, u8 obp1)
+{
+    linePalette_t palette = {};
+    for(int shade = 0; shade < 4; shade++)
+    {
+        palette[PALETTE_BGP + shade] = DMG_COLORS[(bgp >> (2 * shade)) & 0x3];
+        palette[PALETTE_OBP0 + shade] = DMG_COLORS[(obp0 >> (2 * shade)) & 0x3];
+        palette[PALETTE_OBP1 + shade] = DMG_COLORS[(obp1 >> (2 * shade)) & 0x3];
+    }
+    return palette;
+}
+
+
+/**
+ * Expands scanline pixels to gray ABGR8888 pixels, one at a time.
+ */
+void expandScanlineScalar(const u8* pixels, const linePalette_t& palette, u8* output,
+    size_t count)
+{
+    for(size_t i = 0; i < count; i++)
+    {
+        u8 color = palette[pixels[i] & 0xf];
+        output[i * 4] = color;
+        output[i * 4 + 1] = color;
+        output[i * 4 + 2] = color;
+        output[i * 4 + 3] = 0xff;
+    }
+}
+
+
+#ifdef SCANLINE_X86
+
+/**
+ * SSE2 has no byte shuffle, the colours are looked up 16 at a time and then spread over the
+ * 4 bytes of their pixels with unpacks.
+ */
+__attribute__((target("sse2")))
+void expandScanlineSse2(const u8* pixels, const linePalette_t& palette, u8* output,
+    size_t count)
+{
+    const __m128i alpha = _mm_set1_epi32(0xff000000);
+
+    size_t i = 0;
+    for(; i + 16 <= count; i += 16)
+    {
+        alignas(16) u8 colors[16];
+        for(int j = 0; j < 16; j++)
+            colors[j] = palette[pixels[i + j] & 0xf];
+
+        __m128i gray = _mm_load_si128((const __m128i*)colors);
+        __m128i low = _mm_unpacklo_epi8(gray, gray);
+        __m128i high = _mm_unpackhi_epi8(gray, gray);
+        __m128i* out = (__m128i*)(output + i * 4);
+        _mm_storeu_si128(out, _mm_or_si128(_mm_unpacklo_epi16(low, low), alpha));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_unpackhi_epi16(low, low), alpha));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_unpacklo_epi16(high, high), alpha));
+        _mm_storeu_si128(out + 3, _mm_or_si128(_mm_unpackhi_epi16(high, high), alpha));
+    }
+
+    expandScanlineScalar(pixels + i, palette, output + i * 4, count - i);
+}
+
+
+/**
+ * AVX2 looks up 32 colours with a single byte shuffle of the line palette, every 8 colours are
+ * then zero extended to pixels and copied into their gray channels.
+ */
+__attribute__((target("avx2")))
+static inline __m256i expandColorsAvx2(__m128i colors)
+{
+    __m256i pixel = _mm256_cvtepu8_epi32(colors);
+    pixel = _mm256_or_si256(pixel, _mm256_slli_epi32(pixel, 8));
+    pixel = _mm256_or_si256(pixel, _mm256_slli_epi32(pixel, 16));
+    return _mm256_or_si256(pixel, _mm256_set1_epi32(0xff000000));
+}
+
+
+__attribute__((target("avx2")))
+void expandScanlineAvx2(const u8* pixels, const linePalette_t& palette, u8* output,
+    size_t count)
+{
+    const __m256i table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)palette.data()));
+    const __m256i mask = _mm256_set1_epi8(0xf);
+
+    size_t i = 0;
+    for(; i + 32 <= count; i += 32)
+    {
+        __m256i indices = _mm256_loadu_si256((const __m256i*)(pixels + i));
+        __m256i colors = _mm256_shuffle_epi8(table, _mm256_and_si256(indices, mask));
+        __m128i low = _mm256_castsi256_si128(colors);
+        __m128i high = _mm256_extracti128_si256(colors, 1);
+
+        __m256i* out = (__m256i*)(output + i * 4);
+        _mm256_storeu_si256(out, expandColorsAvx2(low));
+        _mm256_storeu_si256(out + 1, expandColorsAvx2(_mm_srli_si128(low, 8)));
+        _mm256_storeu_si256(out + 2, expandColorsAvx2(high));
+        _mm256_storeu_si256(out + 3, expandColorsAvx2(_mm_srli_si128(high, 8)));
+    }
+
+    expandScanlineScalar(pixels + i, palette, output + i * 4, count - i);
+}
+
+
+/**
+ * Picks the widest expansion the processor supports, the build does not assume more than the
+ * target architecture guarantees.
+ */
+static expandFunction_t selectExpandFunction()
+{
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        return expandScanlineAvx2;
+    if(__builtin_cpu_supports("sse2"))
+        return expandScanlineSse2;
+    return expandScanlineScalar;
+}
+
+#endif /* SCANLINE_X86 */
+
+
+/**
+ * Expands scanline pixels to gray ABGR8888 pixels through the colours of a line palette.
+ */
+void expandScanline(const u8* pixels, const linePalette_t& palette, u8* output, size_t count)
+{
+#ifdef SCANLINE_X86
+    static const expandFunction_t expand = selectExpandFunction();
+    expand(pixels, palette, output, count);
+#else
+    expandScanlineScalar(pixels, palette, output, count);
+#endif
+}
@@ -35,6 +35,18 @@ Timer::Timer(std::shared_ptr<InterruptController> interruptController)
 }
 
 
+/**
+ * Copies the timer of a forked emulator, overflows are requested at the given interrupt
+ * controller.
+ */
+Timer::Timer(const Timer& other, std::shared_ptr<InterruptController> interruptController) : Timer(other)
+{
+    assert(interruptController != nullptr);
+
+    this->interruptController = interruptController;
+}
+
+
 Timer::~Timer()
 {
 }
@@ -143,3 +155,25 @@ void Timer::updateTimer(u8 cycles)
         }
     }
 }
+
+
+void Timer::saveState(StateWriter& state) const
+{
+    state.write(this->DIV);
+    state.write(this->TIMA);
+    state.write(this->TMA);
+    state.write(this->TAC);
+    state.write(this->timaClock);
+    state.write(this->divClock);
+}
+
+
+void Timer::loadState(StateReader& state)
+{
+    this->DIV = state.read<u8>();
+    this->TIMA = state.read<u8>();
+    this->TMA = state.read<u8>();
+    this->TAC = state.read<u8>();
+    this->timaClock = state.read<unsigned int>();
+    this->divClock = state.read<unsigned int>();
+}
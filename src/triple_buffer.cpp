@@ -0,0 +1,109 @@
+/**
+ * Copyright (C) 2018 Bart de Haan
+ *
+ * polarGB is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * polarGB is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "polarGB/triple_buffer.h"
+
+
+TripleBuffer::TripleBuffer(size_t frameSize)
+{
+    for(std::vector<u8>& buffer : this->buffers)
+        buffer.assign(frameSize, 0);
+
+    this->writeIndex = 0;
+    this->middle = 1;
+    this->readIndex = 2;
+    this->publishedFrames = 0;
+    this->droppedFrames = 0;
+}
+
+
+TripleBuffer::~TripleBuffer()
+{
+}
+
+
+u8* TripleBuffer::getWriteBuffer()
+{
+    return this->buffers[this->writeIndex].data();
+}
+
+
+/**
+ * Publishes the frame in the write buffer, the producer continues with the old middle buffer.
+ */
+void TripleBuffer::publish()
+{
+    this->publishTimes[this->writeIndex] = std::chrono::steady_clock::now();
+
+    /* Release our writes to the consumer, acquire its reads of the buffer we get back. */
+    u8 previous = this->middle.exchange(this->writeIndex | NEW_FRAME, std::memory_order_acq_rel);
+    if(previous & NEW_FRAME)
+        this->droppedFrames.fetch_add(1, std::memory_order_relaxed);
+    this->publishedFrames.fetch_add(1, std::memory_order_relaxed);
+
+    this->writeIndex = previous & 0x3;
+}
+
+
+bool TripleBuffer::hasNewFrame() const
+{
+    return this->middle.load(std::memory_order_relaxed) & NEW_FRAME;
+}
+
+
+/**
+ * Takes the newest published frame as the read buffer. Returns false if no frame was published
+ * since the last call, the read buffer is unchanged then.
+ */
+bool TripleBuffer::consume()
+{
+    /* Only the consumer clears the flag, so a set flag stays set until the exchange. */
+    if(!this->hasNewFrame())
+        return false;
+
+    u8 previous = this->middle.exchange(this->readIndex, std::memory_order_acq_rel);
+    this->readIndex = previous & 0x3;
+    return true;
+}
+
+
+const u8* TripleBuffer::getReadBuffer() const
+{
+    return this->buffers[this->readIndex].data();
+}
+
+
+std::chrono::steady_clock::time_point TripleBuffer::getReadPublishTime() const
+{
+    return this->publishTimes[this->readIndex];
+}
+
+
+u64 TripleBuffer::getPublishedFrames() const
+{
+    return this->publishedFrames.load(std::memory_order_relaxed);
+}
+
+
+/**
+ * Returns the number of published frames that were replaced by a newer frame before the consumer
+ * took them.
+ */
+u64 TripleBuffer::getDroppedFrames() const
+{
+    return this->droppedFrames.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/cow_memory.h"
+
+
+TEST(CowMemoryTest, ReadWrite)
+{
+    CowMemory memory(0x400);
+    ASSERT_EQ(memory.size(), 0x400u);
+    ASSERT_EQ(memory.read(0x3ff), 0);
+
+    memory.write(0x123, 0x45);
+    ASSERT_EQ(memory.read(0x123), 0x45);
+    ASSERT_EQ(memory.getPage(0x100)[0x23], 0x45);
+    ASSERT_FALSE(memory.isPageShared(0x100));
+}
+
+
+TEST(CowMemoryTest, CopyOnWrite)
+{
+    CowMemory memory(0x400);
+    memory.write(0x010, 0x01);
+    memory.write(0x210, 0x02);
+
+    CowMemory copy(memory);
+    ASSERT_TRUE(memory.isPageShared(0x000));
+    ASSERT_TRUE(copy.isPageShared(0x200));
+    ASSERT_EQ(copy.getPage(0x000), memory.getPage(0x000));
+
+    /* Only the page that is written is copied. */
+    copy.write(0x011, 0x03);
+    ASSERT_NE(copy.getPage(0x000), memory.getPage(0x000));
+    ASSERT_EQ(copy.getPage(0x200), memory.getPage(0x200));
+    ASSERT_FALSE(memory.isPageShared(0x000));
+    ASSERT_TRUE(memory.isPageShared(0x200));
+
+    ASSERT_EQ(copy.read(0x010), 0x01);
+    ASSERT_EQ(copy.read(0x011), 0x03);
+    ASSERT_EQ(memory.read(0x011), 0x00);
+
+    memory.write(0x210, 0x04);
+    ASSERT_EQ(memory.read(0x210), 0x04);
+    ASSERT_EQ(copy.read(0x210), 0x02);
+}
+
+
+TEST(CowMemoryTest, SaveState)
+{
+    CowMemory memory(0x200);
+    memory.write(0x1ff, 0x5a);
+
+    std::vector<u8> buffer;
+    StateWriter writer(buffer);
+    memory.saveState(writer);
+    ASSERT_EQ(buffer.size(), 0x200u);
+
+    CowMemory copy(memory);
+    memory.write(0x1ff, 0x00);
+
+    StateReader reader(buffer);
+    memory.loadState(reader);
+    ASSERT_EQ(memory.read(0x1ff), 0x5a);
+    ASSERT_TRUE(reader.atEnd());
+}
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/interrupt_controller.h"
+#include "polarGB/joypad.h"
+#include "polarGB/timer.h"
+#include "polarGB/mmu.h"
+#include "polarGB/cpu.h"
+#include "test_rom.h"
+
+
+class CpuTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ic = std::make_shared<InterruptController>();
+        gc = std::make_shared<GraphicsController>(ic, true);
+        joypad = std::make_shared<Joypad>(ic);
+        timer = std::make_shared<Timer>(ic);
+        mmu = std::make_shared<Mmu>(gc, ic, timer, joypad);
+    }
+
+    void TearDown() override
+    {
+        if(cpu != nullptr)
+            cpu->shutDown();
+        mmu->shutDown();
+        gc->shutDown();
+    }
+
+    /* Loads a ROM and creates a cpu that starts at its entry point. */
+    void loadRom(const std::string& romPath)
+    {
+        mmu->loadRom(romPath);
+        cpu = std::make_shared<Cpu>(mmu, ic);
+    }
+
+    /* Copies code into memory through the Mmu. */
+    void writeCode(u16 address, const std::vector<u8>& code)
+    {
+        for(u8 byte : code)
+            mmu->write(address++, byte);
+    }
+
+    std::shared_ptr<GraphicsController> gc;
+    std::shared_ptr<InterruptController> ic;
+    std::shared_ptr<Joypad> joypad;
+    std::shared_ptr<Timer> timer;
+    std::shared_ptr<Mmu> mmu;
+    std::shared_ptr<Cpu> cpu;
+};
+
+
+/**************************************
+ * Decode cache
+ *************************************/
+TEST_F(CpuTest, DecodeCacheHitsAndMisses)
+{
+    loadRom(writeTestRom("cpu_decode_cache", {
+        0x00,               /* 0x100: NOP */
+        0x18, 0xfd          /* 0x101: JR 0x100 */
+    }));
+
+    cpu->step();
+    cpu->step();
+    decodeCacheStats_t stats = cpu->getDecodeCacheStats();
+    ASSERT_EQ(stats.misses, 2u);
+    ASSERT_EQ(stats.hits, 0u);
+
+    for(int i = 0; i < 4; i++)
+        cpu->step();
+    stats = cpu->getDecodeCacheStats();
+    ASSERT_EQ(stats.misses, 2u);
+    ASSERT_EQ(stats.hits, 4u);
+    ASSERT_EQ(stats.invalidations, 0u);
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0x100);
+}
+
+
+TEST_F(CpuTest, WrittenRamPageIsDecodedAgain)
+{
+    loadRom(writeTestRom("cpu_ram_write", {
+        0xc3, 0x00, 0xc0    /* 0x100: JP 0xc000 */
+    }));
+    writeCode(0xc000, {
+        0x3e, 0x11,         /* 0xc000: LD A, 0x11 */
+        0x18, 0xfc          /* 0xc002: JR 0xc000 */
+    });
+
+    cpu->step();
+    cpu->step();
+    ASSERT_EQ(cpu->readRegister(RegID_A), 0x11);
+
+    mmu->write(0xc001, 0x22);
+    cpu->step();
+    cpu->step();
+    ASSERT_EQ(cpu->readRegister(RegID_A), 0x22);
+    ASSERT_EQ(cpu->getDecodeCacheStats().invalidations, 1u);
+}
+
+
+TEST_F(CpuTest, SelfModifyingRamCode)
+{
+    loadRom(writeTestRom("cpu_self_modifying", {
+        0xc3, 0x00, 0xc0    /* 0x100: JP 0xc000 */
+    }));
+    writeCode(0xc000, {
+        0x3e, 0x11,         /* 0xc000: LD A, 0x11 */
+        0x3c,               /* 0xc002: INC A, patched to DEC A */
+        0x21, 0x02, 0xc0,   /* 0xc003: LD HL, 0xc002 */
+        0x36, 0x3d,         /* 0xc006: LD (HL), 0x3d */
+        0x18, 0xf6          /* 0xc008: JR 0xc000 */
+    });
+
+    for(int i = 0; i < 3; i++)
+        cpu->step();
+    ASSERT_EQ(cpu->readRegister(RegID_A), 0x12);
+
+    for(int i = 0; i < 5; i++)
+        cpu->step();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0xc003);
+    ASSERT_EQ(cpu->readRegister(RegID_A), 0x10);
+    ASSERT_EQ(cpu->getDecodeCacheStats().invalidations, 1u);
+}
+
+
+TEST_F(CpuTest, RomBankSwitchDecodesOtherBank)
+{
+    /* An MBC1 ROM of 4 banks, bank 1 and 2 both have a routine at 0x4000. */
+    std::vector<u8> rom(0x10000, 0x00);
+    const std::vector<u8> program = {
+        0xcd, 0x00, 0x40,   /* 0x100: CALL 0x4000 */
+        0x3e, 0x02,         /* 0x103: LD A, 0x02 */
+        0xea, 0x00, 0x20,   /* 0x105: LD (0x2000), A */
+        0xcd, 0x00, 0x40,   /* 0x108: CALL 0x4000 */
+        0x18, 0xfe          /* 0x10b: JR 0x10b */
+    };
+    std::copy(program.begin(), program.end(), rom.begin() + 0x100);
+    const std::vector<u8> bank1 = {0x3e, 0x11, 0xc9};   /* LD A, 0x11; RET */
+    const std::vector<u8> bank2 = {0x3e, 0x22, 0xc9};   /* LD A, 0x22; RET */
+    std::copy(bank1.begin(), bank1.end(), rom.begin() + ROM_BANK_SIZE);
+    std::copy(bank2.begin(), bank2.end(), rom.begin() + 2 * ROM_BANK_SIZE);
+    rom[0x147] = 0x01;
+    rom[0x148] = 0x1;
+    setHeaderChecksum(rom);
+    loadRom(writeRomFile("cpu_bank_switch", rom));
+
+    for(int i = 0; i < 3; i++)
+        cpu->step();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0x103);
+    ASSERT_EQ(cpu->readRegister(RegID_A), 0x11);
+
+    for(int i = 0; i < 5; i++)
+        cpu->step();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0x10b);
+    ASSERT_EQ(cpu->readRegister(RegID_A), 0x22);
+
+    /* Both banks were decoded at the same address. */
+    ASSERT_EQ(cpu->getDecodeCacheStats().misses, 8u);
+}
+
+
+/**************************************
+ * Basic blocks
+ *************************************/
+TEST_F(CpuTest, BlockPatchingItsNextInstruction)
+{
+    loadRom(writeTestRom("cpu_block_patch", {
+        0xc3, 0x00, 0xc0    /* 0x100: JP 0xc000 */
+    }));
+    writeCode(0xc000, {
+        0x21, 0x05, 0xc0,   /* 0xc000: LD HL, 0xc005 */
+        0x36, 0x3d,         /* 0xc003: LD (HL), 0x3d */
+        0x3c,               /* 0xc005: INC A, patched to DEC A */
+        0x18, 0xfe          /* 0xc006: JR 0xc006 */
+    });
+    u8 a = cpu->readRegister(RegID_A);
+
+    cpu->runBlock();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0xc000);
+
+    /* The block stops after the write and does not run its stale INC A. */
+    cpu->runBlock();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0xc005);
+    ASSERT_EQ(cpu->readRegister(RegID_A), a);
+
+    cpu->runBlock();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0xc006);
+    ASSERT_EQ(cpu->readRegister(RegID_A), (u8)(a - 1));
+}
+
+
+TEST_F(CpuTest, BlockEndsOnBranch)
+{
+    loadRom(writeTestRom("cpu_block_branch", {
+        0x00,               /* 0x100: NOP */
+        0x00,               /* 0x101: NOP */
+        0xc3, 0x50, 0x01,   /* 0x102: JP 0x150 */
+        0x3c                /* 0x105: INC A */
+    }));
+    u8 a = cpu->readRegister(RegID_A);
+
+    cpu->runBlock();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0x150);
+    ASSERT_EQ(cpu->readRegister(RegID_A), a);
+
+    decodeCacheStats_t stats = cpu->getDecodeCacheStats();
+    ASSERT_EQ(stats.blocksBuilt, 1u);
+    ASSERT_EQ(stats.blocksExecuted, 1u);
+    ASSERT_EQ(stats.misses, 3u);
+}
+
+
+TEST_F(CpuTest, InterruptIsServicedAfterBlock)
+{
+    loadRom(writeTestRom("cpu_block_interrupt", {
+        0xfb,               /* 0x100: EI */
+        0x3e, 0x01,         /* 0x101: LD A, 0x01 */
+        0xe0, 0x0f,         /* 0x103: LDH (IF), A */
+        0x00,               /* 0x105: NOP */
+        0x18, 0xfe          /* 0x106: JR 0x106 */
+    }));
+    ic->setIE(int_vblank);
+
+    /* EI ends its block. */
+    cpu->runBlock();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), 0x101);
+
+    /* The interrupt requested halfway is serviced once the block has ended. */
+    cpu->runBlock();
+    ASSERT_EQ(cpu->readRegister(RegID_PC), INTERRUPT_VERTICAL_BLANKING_ADDR);
+    ASSERT_EQ(cpu->readRegister(RegID_SP), 0xfffc);
+    ASSERT_EQ(mmu->read2Bytes(0xfffc), 0x106);
+    ASSERT_EQ(ic->getIF() & int_vblank, 0);
+}
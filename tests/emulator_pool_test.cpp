@@ -0,0 +1,72 @@
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/emulator_pool.h"
+#include "test_rom.h"
+
+
+/* Increments 0xc000 forever. */
+static const std::vector<u8> COUNTER_PROGRAM = {
+    0x21, 0x00, 0xc0,   /* 0x100: LD HL, 0xc000 */
+    0x34,               /* 0x103: INC (HL) */
+    0x18, 0xfd          /* 0x104: JR 0x103 */
+};
+
+
+TEST(EmulatorPoolTest, RunsEveryInstance)
+{
+    std::string romPath = writeTestRom("emulator_pool_counter", COUNTER_PROGRAM);
+
+    EmulatorPool pool(4, 2);
+    for(u64 i = 0; i < 12; i++)
+        pool.addInstance(romPath, 1 + i % 5);
+    pool.run();
+
+    ASSERT_EQ(pool.getInstanceCount(), 12u);
+    for(size_t i = 0; i < pool.getInstanceCount(); i++)
+    {
+        u64 frames = 1 + i % 5;
+        emulatorStats_t stats = pool.getStats(i);
+        ASSERT_EQ(stats.frames, frames);
+        ASSERT_EQ(stats.slices, (frames + 1) / 2);
+        ASSERT_EQ(stats.cycles, pool.getInstance(i).getCyclesCompleted());
+        ASSERT_EQ(pool.getInstance(i).getFramesCompleted(), frames);
+    }
+}
+
+
+TEST(EmulatorPoolTest, MatchesSingleInstance)
+{
+    std::string romPath = writeTestRom("emulator_pool_counter", COUNTER_PROGRAM);
+
+    EmulatorOptions options;
+    options.headless = true;
+    Emulator reference(options);
+    reference.loadCartridge(romPath);
+    reference.runFrames(4);
+
+    EmulatorPool pool(3, 1);
+    for(int i = 0; i < 6; i++)
+        pool.addInstance(romPath, 4);
+    pool.run();
+
+    for(size_t i = 0; i < pool.getInstanceCount(); i++)
+    {
+        Emulator& emu = pool.getInstance(i);
+        ASSERT_EQ(emu.getCyclesCompleted(), reference.getCyclesCompleted());
+        ASSERT_EQ(emu.readMemory(0xc000), reference.readMemory(0xc000));
+        ASSERT_EQ(emu.readRegister(RegID_PC), reference.readRegister(RegID_PC));
+    }
+}
+
+
+TEST(EmulatorPoolTest, DefaultsToEveryCore)
+{
+    EmulatorPool pool;
+    ASSERT_GE(pool.getThreadCount(), 1u);
+
+    /* Running an empty pool returns immediately. */
+    pool.run();
+    ASSERT_EQ(pool.getInstanceCount(), 0u);
+}
@@ -0,0 +1,161 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/emulator.h"
+#include "test_rom.h"
+
+
+/* Sends "Hi" over the serial port and then increments 0xc000 forever. */
+static const std::vector<u8> SERIAL_PROGRAM = {
+    0x3e, 'H',          /* 0x100: LD A, 'H' */
+    0xe0, 0x01,         /* 0x102: LDH (SB), A */
+    0x3e, 0x81,         /* 0x104: LD A, 0x81 */
+    0xe0, 0x02,         /* 0x106: LDH (SC), A */
+    0x3e, 'i',          /* 0x108: LD A, 'i' */
+    0xe0, 0x01,         /* 0x10a: LDH (SB), A */
+    0x3e, 0x81,         /* 0x10c: LD A, 0x81 */
+    0xe0, 0x02,         /* 0x10e: LDH (SC), A */
+    0x21, 0x00, 0xc0,   /* 0x110: LD HL, 0xc000 */
+    0x34,               /* 0x113: INC (HL) */
+    0x18, 0xfd          /* 0x114: JR 0x113 */
+};
+
+
+class EmulatorTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        EmulatorOptions options;
+        options.headless = true;
+        romPath = writeTestRom("emulator_serial", SERIAL_PROGRAM);
+        emu = std::make_unique<Emulator>(options);
+        emu->loadCartridge(romPath);
+    }
+
+    std::string romPath;
+    std::unique_ptr<Emulator> emu;
+};
+
+
+TEST_F(EmulatorTest, RunUntilProgramCounter)
+{
+    ASSERT_TRUE(emu->runUntil([](Emulator& e) { return e.readRegister(RegID_PC) == 0x110; }));
+    ASSERT_EQ(emu->readRegister(RegID_PC), 0x110);
+    ASSERT_EQ(emu->readRegister(RegID_A), 0x81);
+}
+
+
+TEST_F(EmulatorTest, RunUntilSerialOutput)
+{
+    ASSERT_TRUE(emu->runUntil([](Emulator& e) { return e.getSerialOutput().size() == 2; }));
+
+    const std::vector<u8>& output = emu->getSerialOutput();
+    ASSERT_EQ(std::string(output.begin(), output.end()), "Hi");
+    ASSERT_EQ(emu->readMemory(0xff01), 0xff);
+}
+
+
+TEST_F(EmulatorTest, RunUntilMemoryValue)
+{
+    ASSERT_TRUE(emu->runUntil([](Emulator& e) { return e.readMemory(0xc000) == 0x10; }));
+}
+
+
+TEST_F(EmulatorTest, RunUntilGivesUp)
+{
+    ASSERT_FALSE(emu->runUntil([](Emulator&) { return false; }, 1000));
+    ASSERT_GE(emu->getCyclesCompleted(), 1000u);
+    ASSERT_LT(emu->getCyclesCompleted(), 1010u);
+}
+
+
+TEST_F(EmulatorTest, RunFramesAndCycles)
+{
+    u64 cycles = emu->runFrames(3);
+    ASSERT_EQ(emu->getFramesCompleted(), 3u);
+    ASSERT_GE(cycles, 3u * INSTRUCTIONS_PER_FRAME);
+    ASSERT_EQ(emu->getCyclesCompleted(), cycles);
+
+    u64 moreCycles = emu->runCycles(100);
+    ASSERT_GE(moreCycles, 100u);
+    ASSERT_EQ(emu->getCyclesCompleted(), cycles + moreCycles);
+}
+
+
+TEST_F(EmulatorTest, RunsAreDeterministic)
+{
+    EmulatorOptions options;
+    options.headless = true;
+    Emulator other(options);
+    other.loadCartridge(romPath);
+
+    emu->runFrames(5);
+    other.runFrames(5);
+    ASSERT_EQ(emu->getCyclesCompleted(), other.getCyclesCompleted());
+    ASSERT_EQ(emu->readMemory(0xc000), other.readMemory(0xc000));
+    ASSERT_EQ(emu->readRegister(RegID_PC), other.readRegister(RegID_PC));
+}
+
+
+TEST_F(EmulatorTest, ForkContinuesIdentically)
+{
+    emu->runFrames(2);
+    std::unique_ptr<Emulator> child = emu->fork();
+    ASSERT_EQ(child->getFramesCompleted(), emu->getFramesCompleted());
+    ASSERT_EQ(child->saveState(), emu->saveState());
+
+    emu->runFrames(3);
+    child->runFrames(3);
+    ASSERT_EQ(child->saveState(), emu->saveState());
+    ASSERT_EQ(child->getSerialOutput(), emu->getSerialOutput());
+}
+
+
+TEST_F(EmulatorTest, ForkDoesNotShareWrites)
+{
+    emu->runUntil([](Emulator& e) { return e.readMemory(0xc000) == 0x10; });
+    std::unique_ptr<Emulator> child = emu->fork();
+
+    child->runUntil([](Emulator& e) { return e.readMemory(0xc000) == 0x20; });
+    ASSERT_EQ(emu->readMemory(0xc000), 0x10);
+
+    emu->runUntil([](Emulator& e) { return e.readMemory(0xc000) == 0x30; });
+    ASSERT_EQ(child->readMemory(0xc000), 0x20);
+
+    /* A fork of a fork. */
+    std::unique_ptr<Emulator> grandchild = child->fork();
+    child.reset();
+    grandchild->runUntil([](Emulator& e) { return e.readMemory(0xc000) == 0x21; });
+    ASSERT_EQ(emu->readMemory(0xc000), 0x30);
+}
+
+
+TEST_F(EmulatorTest, RewindRestoresSnapshots)
+{
+    EmulatorOptions options;
+    options.headless = true;
+    options.rewindMemory = 1 << 20;
+    options.rewindInterval = 2;
+    Emulator rewinding(options);
+    rewinding.loadCartridge(romPath);
+
+    rewinding.runFrames(4);
+    std::vector<u8> snapshot = rewinding.saveState();
+    rewinding.runFrames(4);
+    ASSERT_EQ(rewinding.getRewindBuffer()->getSnapshotCount(), 4u);
+
+    /* The newest snapshot is the current frame, two steps back is frame 4. */
+    ASSERT_TRUE(rewinding.rewind());
+    ASSERT_EQ(rewinding.getFramesCompleted(), 8u);
+    ASSERT_TRUE(rewinding.rewind());
+    ASSERT_TRUE(rewinding.rewind());
+    ASSERT_EQ(rewinding.getFramesCompleted(), 4u);
+    ASSERT_EQ(rewinding.saveState(), snapshot);
+
+    ASSERT_TRUE(rewinding.rewind());
+    ASSERT_FALSE(rewinding.rewind());
+    ASSERT_FALSE(emu->rewind());
+}
@@ -0,0 +1,367 @@
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/interrupt_controller.h"
+#include "polarGB/graphics_controller.h"
+
+
+const int CYCLES_PER_FRAME = 17556;
+
+
+class GraphicsControllerTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ic = std::make_shared<InterruptController>();
+        gc = std::make_shared<GraphicsController>(ic, true);
+
+        /* Identity palette, shade index n shows colour n. */
+        gc->displayRegisterWrite(RegBGP, 0xe4);
+    }
+
+    void TearDown() override
+    {
+        gc->shutDown();
+    }
+
+    void runFrame()
+    {
+        for(int cycles = 0; cycles < CYCLES_PER_FRAME; cycles += 4)
+            gc->update(4);
+    }
+
+    std::shared_ptr<InterruptController> ic;
+    std::shared_ptr<GraphicsController> gc;
+};
+
+
+TEST_F(GraphicsControllerTest, HeadlessFrameRequestsVBlank)
+{
+    ic->setIE(0x1);
+    runFrame();
+    ASSERT_EQ(ic->getIF() & 0x1, 0x1);
+}
+
+
+TEST_F(GraphicsControllerTest, HeadlessRendersIntoFramebuffer)
+{
+    /* Tile 0 at 0x8000 with every pixel set to shade 3, the tile map is zero filled. */
+    for(u16 addr = 0; addr < 16; addr++)
+        gc->vramWrite(addr, 0xff);
+    gc->displayRegisterWrite(RegLCDC, 0x91);
+
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(framebuffer[0], 0);
+    ASSERT_EQ(framebuffer[3], 0xff);
+    ASSERT_EQ(framebuffer[(SCREEN_WIDTH * SCREEN_HEIGHT - 1) * 4], 0);
+
+    /* Disabling the LCD renders white lines. */
+    gc->displayRegisterWrite(RegLCDC, 0x00);
+    runFrame();
+    ASSERT_EQ(gc->getFramebuffer()[0], 0xff);
+}
+
+
+static u8 pixelAt(const u8* framebuffer, int x, int y)
+{
+    return framebuffer[(y * SCREEN_WIDTH + x) * 4];
+}
+
+
+TEST_F(GraphicsControllerTest, BackgroundScrollsByPixel)
+{
+    /* Tile 1 is black and only used at tile map position 1 of the first tile row. */
+    for(u16 addr = 0x10; addr < 0x20; addr++)
+        gc->vramWrite(addr, 0xff);
+    gc->vramWrite(0x1801, 0x01);
+    gc->displayRegisterWrite(RegLCDC, 0x91);
+    gc->displayRegisterWrite(RegSCX, 3);
+
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 4, 0), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 5, 0), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 12, 7), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 13, 7), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 5, 8), 0xff);
+}
+
+
+TEST_F(GraphicsControllerTest, BackgroundPaletteMapsShades)
+{
+    /* Tile 0 rows alternate between shade 1 and shade 2. */
+    for(u16 addr = 0; addr < 16; addr += 4)
+    {
+        gc->vramWrite(addr, 0xff);
+        gc->vramWrite(addr + 3, 0xff);
+    }
+    gc->displayRegisterWrite(RegLCDC, 0x91);
+
+    /* Shade 1 shows colour 3 and shade 2 colour 0. */
+    gc->displayRegisterWrite(RegBGP, 0xcc);
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 0, 1), 0xff);
+    ASSERT_EQ(framebuffer[(SCREEN_WIDTH + 1) * 4 + 3], 0xff);
+
+    /* Colour 1 and colour 2 are the light and dark grays. */
+    gc->displayRegisterWrite(RegBGP, 0x24);
+    runFrame();
+    ASSERT_EQ(pixelAt(framebuffer, 7, 0), 0xaa);
+    ASSERT_EQ(pixelAt(framebuffer, 7, 1), 0x55);
+}
+
+
+TEST_F(GraphicsControllerTest, SignedTileDataArea)
+{
+    /* With LCDC bit 4 cleared tile 0x80 is stored at 0x8800 and tile 0 at 0x9000. */
+    for(u16 addr = 0x800; addr < 0x810; addr++)
+        gc->vramWrite(addr, 0xff);
+    for(u16 addr = 0x1800; addr < 0x1c00; addr++)
+        gc->vramWrite(addr, 0x80);
+    gc->vramWrite(0x1801, 0x00);
+    gc->displayRegisterWrite(RegLCDC, 0x81);
+
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 8, 0), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 16, 0), 0);
+}
+
+
+TEST_F(GraphicsControllerTest, WindowCoversBackground)
+{
+    /* The window map at 0x9c00 uses the black tile 1, the background uses the white tile 0. */
+    for(u16 addr = 0x10; addr < 0x20; addr++)
+        gc->vramWrite(addr, 0xff);
+    for(u16 addr = 0x1c00; addr < 0x2000; addr++)
+        gc->vramWrite(addr, 0x01);
+    gc->displayRegisterWrite(RegLCDC, 0xf1);
+    gc->displayRegisterWrite(RegWX, 7 + 80);
+    gc->displayRegisterWrite(RegWY, 72);
+
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 79, 100), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 80, 100), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 159, 143), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 100, 71), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 100, 72), 0);
+
+    /* A window that starts left of the screen covers the whole line. */
+    gc->displayRegisterWrite(RegWX, 3);
+    runFrame();
+    ASSERT_EQ(pixelAt(gc->getFramebuffer(), 0, 100), 0);
+}
+
+
+TEST_F(GraphicsControllerTest, TileCacheFollowsVramWrites)
+{
+    gc->clearDirtyTiles();
+
+    /* Row 2 of tile 300: low plane 0b10100000, high plane 0b11000000. */
+    gc->vramWrite(300 * 16 + 4, 0xa0);
+    gc->vramWrite(300 * 16 + 5, 0xc0);
+    ASSERT_EQ(gc->getTileRow(300, 2), 0x0000000000010203u);
+    ASSERT_EQ(gc->getTileRow(300, 3), 0u);
+    ASSERT_TRUE(gc->getDirtyTiles().test(300));
+    ASSERT_EQ(gc->getDirtyTiles().count(), 1u);
+
+    /* Tile maps are not tile data. */
+    gc->vramWrite(0x1800, 0xff);
+    ASSERT_EQ(gc->getDirtyTiles().count(), 1u);
+
+    /* The cache is rebuilt from a save state. */
+    std::vector<u8> buffer;
+    StateWriter writer(buffer);
+    gc->saveState(writer);
+
+    GraphicsController other(ic, true);
+    StateReader reader(buffer);
+    other.loadState(reader);
+    ASSERT_EQ(other.getTileRow(300, 2), 0x0000000000010203u);
+    other.shutDown();
+}
+
+
+TEST_F(GraphicsControllerTest, TenObjectsPerScanline)
+{
+    /* Tile 1 is black, 11 objects side by side on the first 8 lines. */
+    for(u16 addr = 16; addr < 32; addr++)
+        gc->vramWrite(addr, 0xff);
+    for(u16 object = 0; object < 11; object++)
+    {
+        gc->oamWrite(object * 4, 16);
+        gc->oamWrite(object * 4 + 1, 8 + (10 - object) * 8);
+        gc->oamWrite(object * 4 + 2, 1);
+    }
+    gc->displayRegisterWrite(RegOBP0, 0xe4);
+    gc->displayRegisterWrite(RegLCDC, 0x93);
+
+    runFrame();
+
+    /* The last object in OAM is dropped, it covers the first 8 pixels. */
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 7, 0), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 8, 0), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 87, 7), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 88, 7), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 8, 8), 0xff);
+}
+
+
+TEST_F(GraphicsControllerTest, ObjectFlipAndPaletteFlags)
+{
+    /* Tile 1 has a single shade 3 pixel in the top left corner, OBP1 inverts the colours. */
+    gc->vramWrite(16, 0x80);
+    gc->vramWrite(17, 0x80);
+    gc->displayRegisterWrite(RegOBP0, 0xe4);
+    gc->displayRegisterWrite(RegOBP1, 0x1b);
+    gc->displayRegisterWrite(RegLCDC, 0x93);
+
+    /* Object 0 at screen position (0,0) is flipped in both directions. */
+    gc->oamWrite(0, 16);
+    gc->oamWrite(1, 8);
+    gc->oamWrite(2, 1);
+    gc->oamWrite(3, 0x60);
+
+    /* Object 1 at (16,0) uses OBP1, its transparent pixels show the background. */
+    gc->oamWrite(4, 16);
+    gc->oamWrite(5, 24);
+    gc->oamWrite(6, 1);
+    gc->oamWrite(7, 0x10);
+
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 7, 7), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 16, 0), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 17, 0), 0xff);
+
+    gc->displayRegisterWrite(RegOBP1, 0xe4);
+    runFrame();
+    ASSERT_EQ(pixelAt(framebuffer, 16, 0), 0);
+
+    /* Clearing LCDC bit 1 hides the objects. */
+    gc->displayRegisterWrite(RegLCDC, 0x91);
+    runFrame();
+    ASSERT_EQ(pixelAt(framebuffer, 7, 7), 0xff);
+}
+
+
+TEST_F(GraphicsControllerTest, ObjectBehindBackground)
+{
+    /* The background has shade 1 in tile columns 1 and up, tile 2 is a black object. */
+    for(u16 addr = 16; addr < 48; addr += 2)
+        gc->vramWrite(addr, 0xff);
+    gc->vramWrite(33, 0xff);
+    gc->vramWrite(35, 0xff);
+    for(u16 column = 1; column < 32; column++)
+        gc->vramWrite(0x1800 + column, 1);
+    gc->displayRegisterWrite(RegOBP0, 0xe4);
+    gc->displayRegisterWrite(RegLCDC, 0x93);
+
+    /* An object behind the background at (4,0) and one in front of it at (8,0). The first has
+     * priority where they overlap. */
+    u8 objects[2][4] = {{16, 12, 2, 0x80}, {16, 16, 2, 0x00}};
+    for(u16 i = 0; i < 8; i++)
+        gc->oamWrite(i, objects[i / 4][i % 4]);
+
+    runFrame();
+
+    /* Only the top rows of tile 2 are black. */
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 4, 0), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 8, 0), 0xaa);
+    ASSERT_EQ(pixelAt(framebuffer, 11, 1), 0xaa);
+    ASSERT_EQ(pixelAt(framebuffer, 12, 0), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 15, 1), 0);
+}
+
+
+TEST_F(GraphicsControllerTest, TallObjects)
+{
+    /* Tiles 2 and 3 form an 8x16 object, only tile 3 has black pixels. */
+    for(u16 addr = 48; addr < 64; addr++)
+        gc->vramWrite(addr, 0xff);
+    gc->oamWrite(0, 16);
+    gc->oamWrite(1, 8);
+    gc->oamWrite(2, 3);
+    gc->displayRegisterWrite(RegOBP0, 0xe4);
+    gc->displayRegisterWrite(RegLCDC, 0x97);
+
+    runFrame();
+
+    /* The odd tile index still starts with the even tile. */
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 7), 0xff);
+    ASSERT_EQ(pixelAt(framebuffer, 0, 8), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 7, 15), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 0, 16), 0xff);
+
+    /* Y flip swaps the tiles. */
+    gc->oamWrite(3, 0x40);
+    runFrame();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 7), 0);
+    ASSERT_EQ(pixelAt(framebuffer, 0, 8), 0xff);
+}
+
+
+TEST_F(GraphicsControllerTest, FrameSkipKeepsTiming)
+{
+    auto renderedIc = std::make_shared<InterruptController>();
+    GraphicsController rendered(renderedIc, true);
+
+    gc->setFrameSkip(2);
+    for(GraphicsController* controller : {gc.get(), &rendered})
+    {
+        controller->vramWrite(0, 0xff);
+        controller->displayRegisterWrite(RegSTAT, 0x78);
+        controller->displayRegisterWrite(RegLYC, 100);
+        controller->displayRegisterWrite(RegLCDC, 0x93);
+    }
+
+    /* Skipped frames have the same lines, modes and interrupts. */
+    for(int cycles = 0; cycles < 4 * CYCLES_PER_FRAME; cycles += 4)
+    {
+        gc->update(4);
+        rendered.update(4);
+        ASSERT_EQ(gc->displayRegisterRead(RegLY), rendered.displayRegisterRead(RegLY));
+        ASSERT_EQ(gc->displayRegisterRead(RegSTAT), rendered.displayRegisterRead(RegSTAT));
+        ASSERT_EQ(ic->getIF(), renderedIc->getIF());
+    }
+    rendered.shutDown();
+}
+
+
+TEST_F(GraphicsControllerTest, SkippedFramesKeepLastFrame)
+{
+    gc->setFrameSkip(2);
+    gc->displayRegisterWrite(RegLCDC, 0x91);
+    runFrame();
+
+    const u8* framebuffer = gc->getFramebuffer();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0xff);
+
+    /* The next 2 frames are skipped, the fourth frame is rendered. */
+    for(u16 addr = 0; addr < 16; addr++)
+        gc->vramWrite(addr, 0xff);
+    runFrame();
+    runFrame();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0xff);
+
+    runFrame();
+    ASSERT_EQ(pixelAt(framebuffer, 0, 0), 0);
+}
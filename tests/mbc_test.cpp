@@ -0,0 +1,357 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/cartridge.h"
+#include "polarGB/interrupt_controller.h"
+#include "polarGB/joypad.h"
+#include "polarGB/timer.h"
+#include "polarGB/mmu.h"
+#include "test_rom.h"
+
+
+static u16 readBankNumber(Cartridge& cartridge, u16 address)
+{
+    return cartridge.read(address) | (cartridge.read(address + 1) << 8);
+}
+
+
+/**************************************
+ * No memory bank controller
+ *************************************/
+TEST(MBCTest, NoMBCIgnoresRomWrites)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("nombc", {}, 0x00, 0x0, 0x0));
+
+    cartridge.write(0x2000, 0x02);
+    ASSERT_EQ(readBankNumber(cartridge, 0x0000), 0);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 1);
+    ASSERT_FALSE(cartridge.hasRam());
+}
+
+
+TEST(MBCTest, NoMBCWithRam)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("nombc_ram", {}, 0x08, 0x0, 0x2));
+
+    cartridge.write(0xa123, 0x5a);
+    ASSERT_EQ(cartridge.read(0xa123), 0x5a);
+    ASSERT_NE(cartridge.getRamPage(0xa000), nullptr);
+}
+
+
+/**************************************
+ * MBC1
+ *************************************/
+TEST(MBC1Test, RomBankSelect)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc1", {}, 0x01, 0x2, 0x0));
+
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 1);
+
+    cartridge.write(0x2000, 0x05);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 5);
+    ASSERT_EQ(cartridge.getRomBank(0x4000), 5);
+
+    /* Bank 0 selects bank 1. */
+    cartridge.write(0x3fff, 0x00);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 1);
+
+    /* Banks beyond the ROM size wrap around. */
+    cartridge.write(0x2000, 0x1f);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0x1f & 0x7);
+    ASSERT_EQ(readBankNumber(cartridge, 0x0000), 0);
+}
+
+
+TEST(MBC1Test, UpperRomBankBitsAndMode)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc1_2mb", {}, 0x01, 0x6, 0x0));
+
+    cartridge.write(0x2000, 0x03);
+    cartridge.write(0x4000, 0x02);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0x43);
+    ASSERT_EQ(readBankNumber(cartridge, 0x0000), 0);
+
+    /* In mode 1 the upper bits also select the bank at 0x0000-0x3fff. */
+    cartridge.write(0x6000, 0x01);
+    ASSERT_EQ(readBankNumber(cartridge, 0x0000), 0x40);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0x43);
+
+    cartridge.write(0x6000, 0x00);
+    ASSERT_EQ(readBankNumber(cartridge, 0x0000), 0);
+}
+
+
+TEST(MBC1Test, RamEnableAndBankSelect)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc1_ram", {}, 0x03, 0x2, 0x3));
+
+    /* RAM is disabled after power up. */
+    cartridge.write(0xa000, 0x11);
+    ASSERT_EQ(cartridge.read(0xa000), 0xff);
+    ASSERT_EQ(cartridge.getRamPage(0xa000), nullptr);
+
+    cartridge.write(0x0000, 0x0a);
+    ASSERT_NE(cartridge.getRamPage(0xa000), nullptr);
+
+    /* RAM banking only applies in mode 1. */
+    cartridge.write(0x6000, 0x01);
+    for(u8 bank = 0; bank < 4; bank++)
+    {
+        cartridge.write(0x4000, bank);
+        cartridge.write(0xa000, 0x10 + bank);
+    }
+    for(u8 bank = 0; bank < 4; bank++)
+    {
+        cartridge.write(0x4000, bank);
+        ASSERT_EQ(cartridge.read(0xa000), 0x10 + bank);
+    }
+
+    cartridge.write(0x6000, 0x00);
+    ASSERT_EQ(cartridge.read(0xa000), 0x10);
+
+    cartridge.write(0x0000, 0x00);
+    ASSERT_EQ(cartridge.read(0xa000), 0xff);
+}
+
+
+/**************************************
+ * MBC2
+ *************************************/
+TEST(MBC2Test, RomBankSelectUsesAddressBit8)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc2", {}, 0x05, 0x3, 0x0));
+
+    cartridge.write(0x2100, 0x06);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 6);
+
+    /* Without address bit 8 the write goes to RAM enable. */
+    cartridge.write(0x2000, 0x03);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 6);
+
+    cartridge.write(0x0100, 0x00);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 1);
+}
+
+
+TEST(MBC2Test, HalfByteRam)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc2_ram", {}, 0x06, 0x1, 0x0));
+
+    cartridge.write(0xa001, 0x5);
+    ASSERT_EQ(cartridge.read(0xa001), 0xff);
+
+    cartridge.write(0x0000, 0x0a);
+    cartridge.write(0xa001, 0xa5);
+    ASSERT_EQ(cartridge.read(0xa001), 0xf5);
+
+    /* The 512 entries repeat over the whole RAM area. */
+    ASSERT_EQ(cartridge.read(0xa201), 0xf5);
+    ASSERT_EQ(cartridge.read(0xbe01), 0xf5);
+
+    /* The RAM can not be mapped as plain memory. */
+    ASSERT_EQ(cartridge.getRamPage(0xa000), nullptr);
+}
+
+
+/**************************************
+ * MBC3
+ *************************************/
+TEST(MBC3Test, RomBankSelect)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc3", {}, 0x11, 0x6, 0x0));
+
+    cartridge.write(0x2000, 0x7f);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0x7f);
+
+    cartridge.write(0x2000, 0x00);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 1);
+}
+
+
+TEST(MBC3Test, RamBankSelect)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc3_ram", {}, 0x13, 0x2, 0x3));
+
+    cartridge.write(0x0000, 0x0a);
+    for(u8 bank = 0; bank < 4; bank++)
+    {
+        cartridge.write(0x4000, bank);
+        cartridge.write(0xbfff, 0x20 + bank);
+    }
+    for(u8 bank = 0; bank < 4; bank++)
+    {
+        cartridge.write(0x4000, bank);
+        ASSERT_EQ(cartridge.read(0xbfff), 0x20 + bank);
+    }
+}
+
+
+TEST(MBC3Test, ClockRegistersAndLatch)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc3_rtc", {}, 0x10, 0x2, 0x3));
+
+    cartridge.write(0x0000, 0x0a);
+    cartridge.write(0x4000, 0x08);
+    ASSERT_EQ(cartridge.getRamPage(0xa000), nullptr);
+
+    cartridge.write(0xa000, 0x2a);
+    ASSERT_EQ(cartridge.read(0xa000), 0x2a);
+
+    cartridge.write(0x4000, 0x0c);
+    cartridge.write(0xa000, 0x01);
+    ASSERT_EQ(cartridge.read(0xa000), 0x01);
+
+    cartridge.write(0x6000, 0x00);
+    cartridge.write(0x6000, 0x01);
+    cartridge.write(0x4000, 0x08);
+    ASSERT_EQ(cartridge.read(0xa000), 0x2a);
+
+    /* Selecting a RAM bank maps the RAM again. */
+    cartridge.write(0x4000, 0x00);
+    ASSERT_NE(cartridge.getRamPage(0xa000), nullptr);
+}
+
+
+/**************************************
+ * MBC5
+ *************************************/
+TEST(MBC5Test, NineBitRomBankSelect)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc5", {}, 0x19, 0x8, 0x0));
+
+    cartridge.write(0x2000, 0x34);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0x34);
+
+    cartridge.write(0x3000, 0x01);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0x134);
+    ASSERT_EQ(cartridge.getRomBank(0x4000), 0x134);
+
+    /* Bank 0 can be mapped at 0x4000-0x7fff. */
+    cartridge.write(0x2000, 0x00);
+    cartridge.write(0x3000, 0x00);
+    ASSERT_EQ(readBankNumber(cartridge, 0x4000), 0);
+}
+
+
+TEST(MBC5Test, RamBankSelect)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("mbc5_ram", {}, 0x1b, 0x1, 0x4));
+
+    cartridge.write(0x0000, 0x0a);
+    for(u8 bank = 0; bank < 16; bank++)
+    {
+        cartridge.write(0x4000, bank);
+        cartridge.write(0xa800, 0x30 + bank);
+    }
+    for(u8 bank = 0; bank < 16; bank++)
+    {
+        cartridge.write(0x4000, bank);
+        ASSERT_EQ(cartridge.read(0xa800), 0x30 + bank);
+    }
+}
+
+
+/**************************************
+ * Mmu page table
+ *************************************/
+class MBCMmuTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ic = std::make_shared<InterruptController>();
+        gc = std::make_shared<GraphicsController>(ic, true);
+        joypad = std::make_shared<Joypad>(ic);
+        timer = std::make_shared<Timer>(ic);
+        mmu = std::make_shared<Mmu>(gc, ic, timer, joypad);
+    }
+
+    void TearDown() override
+    {
+        mmu->shutDown();
+        gc->shutDown();
+    }
+
+    std::shared_ptr<GraphicsController> gc;
+    std::shared_ptr<InterruptController> ic;
+    std::shared_ptr<Joypad> joypad;
+    std::shared_ptr<Timer> timer;
+    std::shared_ptr<Mmu> mmu;
+};
+
+
+TEST_F(MBCMmuTest, BankSwitchUpdatesPageTable)
+{
+    mmu->loadRom(writeTestRom("mmu_mbc5", {}, 0x19, 0x4, 0x0));
+    ASSERT_EQ(mmu->read(0x4000), 1);
+
+    mmu->write(0x2000, 0x09);
+    ASSERT_EQ(mmu->read(0x4000), 9);
+    ASSERT_EQ(mmu->read2Bytes(0x4000), 9);
+    ASSERT_EQ(mmu->getRomPage(0x4000), 9 << 6);
+}
+
+
+TEST_F(MBCMmuTest, CartridgeRam)
+{
+    mmu->loadRom(writeTestRom("mmu_mbc1_ram", {}, 0x03, 0x1, 0x3));
+
+    mmu->write(0x0000, 0x0a);
+    mmu->write(0x6000, 0x01);
+    mmu->write(0x4000, 0x01);
+    u32 version = mmu->getPageVersion(0xa000);
+    mmu->write(0xa000, 0x77);
+    ASSERT_EQ(mmu->read(0xa000), 0x77);
+
+    mmu->write(0x4000, 0x02);
+    ASSERT_NE(mmu->getPageVersion(0xa000), version);
+    ASSERT_NE(mmu->read(0xa000), 0x77);
+
+    mmu->write(0x4000, 0x01);
+    ASSERT_EQ(mmu->read(0xa000), 0x77);
+
+    /* Disabled RAM takes the slow path through the cartridge. */
+    mmu->write(0x0000, 0x00);
+    ASSERT_EQ(mmu->read(0xa000), 0xff);
+}
+
+
+TEST(MBCTest, CopySharesRamUntilWritten)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("copy_mbc1_ram", {}, 0x03, 0x1, 0x3));
+    cartridge.write(0x0000, 0x0a);
+    cartridge.write(0xa010, 0x11);
+
+    Cartridge copy(cartridge);
+    ASSERT_EQ(copy.read(0xa010), 0x11);
+    ASSERT_EQ(copy.getRamPage(0xa000), cartridge.getRamPage(0xa000));
+    ASSERT_EQ(copy.getWritableRamPage(0xa000), nullptr);
+
+    copy.write(0xa010, 0x22);
+    ASSERT_EQ(copy.read(0xa010), 0x22);
+    ASSERT_EQ(cartridge.read(0xa010), 0x11);
+    ASSERT_NE(copy.getWritableRamPage(0xa000), nullptr);
+    ASSERT_NE(cartridge.getWritableRamPage(0xa000), nullptr);
+
+    /* Bank switching in the copy leaves the original alone. */
+    copy.write(0x6000, 0x01);
+    copy.write(0x4000, 0x01);
+    ASSERT_NE(copy.read(0xa010), 0x22);
+    ASSERT_EQ(cartridge.read(0xa010), 0x11);
+}
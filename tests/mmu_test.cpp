@@ -213,3 +213,27 @@ TEST_F(MmuTest, HRAMUpperBoundTest)
     mmu->write(testAddr, testValue);
     ASSERT_EQ(mmu->read(testAddr), testValue);
 }
+
+
+/**************************************
+ * Decode cache support
+ *************************************/
+TEST_F(MmuTest, PageVersionChangesOnWrite)
+{
+    u16 testAddr = WRAM_START_ADDR + 0x120;
+    u32 version = mmu->getPageVersion(testAddr);
+    u32 neighbourVersion = mmu->getPageVersion(testAddr + 0x100);
+
+    mmu->write(testAddr, 0x3c);
+    ASSERT_NE(mmu->getPageVersion(testAddr), version);
+    ASSERT_EQ(mmu->getPageVersion(testAddr + 0x100), neighbourVersion);
+}
+
+
+TEST_F(MmuTest, RomPageWithoutBanking)
+{
+    ASSERT_EQ(mmu->getRomPage(0x0000), 0u);
+    ASSERT_EQ(mmu->getRomPage(0x3fff), 0x3fu);
+    ASSERT_EQ(mmu->getRomPage(0x4000), 0x40u);
+    ASSERT_EQ(mmu->getRomPage(0x7fff), 0x7fu);
+}
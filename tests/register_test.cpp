@@ -136,3 +136,100 @@ TEST(RegisterTest, FlagsFalse)
     ASSERT_EQ(reg.getFlagCarry(), false);
     ASSERT_EQ(reg.read(RegID_F) & 0x10, 0);
 }
+
+
+TEST(RegisterTest, SingleRegistersShareRegisterPairs)
+{
+    Register reg;
+
+    reg.write(RegID_B, 0x12);
+    reg.write(RegID_C, 0x34);
+    EXPECT_EQ(reg.read(RegID_BC), 0x1234);
+
+    reg.write(RegID_DE, 0xabcd);
+    EXPECT_EQ(reg.read(RegID_D), 0xab);
+    EXPECT_EQ(reg.read(RegID_E), 0xcd);
+
+    reg.write(RegID_L, 0x99);
+    EXPECT_EQ(reg.read(RegID_HL) & 0xff, 0x99);
+
+    reg.write(RegID_F, 0xff);
+    EXPECT_EQ(reg.read(RegID_F), 0xf0);
+}
+
+
+TEST(RegisterTest, TemplateAccess)
+{
+    Register reg;
+
+    reg.set<RegID_HL>(0xc0de);
+    EXPECT_EQ(reg.get<RegID_H>(), 0xc0);
+    EXPECT_EQ(reg.get<RegID_L>(), 0xde);
+    EXPECT_EQ(reg.read(RegID_HL), 0xc0de);
+
+    reg.set<RegID_A>(0x42);
+    EXPECT_EQ(reg.read(RegID_A), 0x42);
+
+    reg.set<RegID_AF>(0x12ff);
+    EXPECT_EQ(reg.get<RegID_AF>(), 0x12f0);
+
+    reg.set<RegID_SP>(0xdff0);
+    EXPECT_EQ(reg.read(RegID_SP), 0xdff0);
+}
+
+
+TEST(RegisterTest, LazyFlagsAdd)
+{
+    Register reg;
+
+    /* 0x3a + 0xc6 = 0x100: zero, half carry and carry. */
+    EXPECT_EQ(reg.setFlagsAdd(0x3a, 0xc6, false), 0x00);
+    EXPECT_TRUE(reg.getFlagZero());
+    EXPECT_FALSE(reg.getFlagSub());
+    EXPECT_TRUE(reg.getFlagHalfCarry());
+    EXPECT_TRUE(reg.getFlagCarry());
+    EXPECT_EQ(reg.read(RegID_F), 0xb0);
+
+    /* 0x0e + 0x01 + carry = 0x10: only half carry. */
+    EXPECT_EQ(reg.setFlagsAdd(0x0e, 0x01, true), 0x10);
+    EXPECT_EQ(reg.read(RegID_F), 0x20);
+}
+
+
+TEST(RegisterTest, LazyFlagsSub)
+{
+    Register reg;
+
+    /* 0x3e - 0x3e = 0: zero and sub. */
+    EXPECT_EQ(reg.setFlagsSub(0x3e, 0x3e, false), 0x00);
+    EXPECT_EQ(reg.read(RegID_F), 0xc0);
+
+    /* 0x10 - 0x20 - carry = 0xef: sub, half carry and carry. */
+    EXPECT_EQ(reg.setFlagsSub(0x10, 0x20, true), 0xef);
+    EXPECT_FALSE(reg.getFlagZero());
+    EXPECT_TRUE(reg.getFlagSub());
+    EXPECT_TRUE(reg.getFlagHalfCarry());
+    EXPECT_TRUE(reg.getFlagCarry());
+    EXPECT_EQ(reg.read(RegID_AF) & 0xff, 0x70);
+}
+
+
+TEST(RegisterTest, LazyFlagsPartialUpdate)
+{
+    Register reg;
+
+    /* Updating a single flag keeps the other lazily computed flags. */
+    reg.setFlagsAdd(0xff, 0x01, false);
+    reg.setFlagZero(false);
+    EXPECT_FALSE(reg.getFlagZero());
+    EXPECT_TRUE(reg.getFlagHalfCarry());
+    EXPECT_TRUE(reg.getFlagCarry());
+    EXPECT_EQ(reg.read(RegID_F), 0x30);
+
+    /* Writing F replaces the lazily computed flags. */
+    reg.setFlagsSub(0x00, 0x01, false);
+    reg.write(RegID_F, 0x80);
+    EXPECT_TRUE(reg.getFlagZero());
+    EXPECT_FALSE(reg.getFlagSub());
+    EXPECT_FALSE(reg.getFlagCarry());
+}
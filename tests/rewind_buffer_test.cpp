@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/rewind_buffer.h"
+
+
+/* State with a counter at the front, a few scattered changes and large unchanged areas. */
+static std::vector<u8> makeState(u8 counter)
+{
+    std::vector<u8> state(0x4000, 0x00);
+    std::fill(state.begin() + 0x2000, state.begin() + 0x2800, 0x55);
+    state[0] = counter;
+    state[0x1234] = counter * 3;
+    state[0x3fff] = counter ^ 0xaa;
+    return state;
+}
+
+
+TEST(RewindBufferTest, PopsInReverseOrder)
+{
+    RewindBuffer buffer(1 << 20, 4);
+    for(u8 i = 0; i < 10; i++)
+        buffer.record(makeState(i));
+    ASSERT_EQ(buffer.getSnapshotCount(), 10u);
+
+    std::vector<u8> state;
+    for(int i = 9; i >= 0; i--)
+    {
+        ASSERT_TRUE(buffer.pop(state));
+        ASSERT_EQ(state, makeState(i));
+    }
+
+    ASSERT_FALSE(buffer.pop(state));
+    ASSERT_EQ(buffer.getMemoryUsage(), 0u);
+}
+
+
+TEST(RewindBufferTest, RecordsAfterRewinding)
+{
+    RewindBuffer buffer(1 << 20, 4);
+    std::vector<u8> state;
+    for(u8 i = 0; i < 6; i++)
+        buffer.record(makeState(i));
+
+    /* Rewind past the second keyframe and continue from there. */
+    for(int i = 0; i < 3; i++)
+        ASSERT_TRUE(buffer.pop(state));
+    ASSERT_EQ(state, makeState(3));
+
+    buffer.record(makeState(100));
+    buffer.record(makeState(101));
+    ASSERT_TRUE(buffer.pop(state));
+    ASSERT_EQ(state, makeState(101));
+    ASSERT_TRUE(buffer.pop(state));
+    ASSERT_EQ(state, makeState(100));
+    ASSERT_TRUE(buffer.pop(state));
+    ASSERT_EQ(state, makeState(2));
+}
+
+
+TEST(RewindBufferTest, DifferencesAreCompressed)
+{
+    RewindBuffer buffer(1 << 20, 8);
+    buffer.record(makeState(0));
+    size_t keyframeSize = buffer.getMemoryUsage();
+    buffer.record(makeState(1));
+
+    ASSERT_LT(keyframeSize, 0x1000u);
+    ASSERT_LT(buffer.getMemoryUsage() - keyframeSize, 32u);
+}
+
+
+TEST(RewindBufferTest, MemoryIsBounded)
+{
+    RewindBuffer probe(1 << 20, 4);
+    probe.record(makeState(0));
+    size_t keyframeSize = probe.getMemoryUsage();
+
+    size_t capacity = 3 * keyframeSize;
+    RewindBuffer buffer(capacity, 4);
+    for(int i = 0; i < 200; i++)
+    {
+        buffer.record(makeState(i));
+        ASSERT_LE(buffer.getMemoryUsage(), capacity);
+    }
+
+    /* The oldest groups are dropped, the newest snapshots can still be restored. */
+    std::vector<u8> state;
+    ASSERT_GT(buffer.getSnapshotCount(), 0u);
+    ASSERT_TRUE(buffer.pop(state));
+    ASSERT_EQ(state, makeState(199));
+
+    size_t remaining = 0;
+    while(buffer.pop(state))
+        remaining++;
+    ASSERT_EQ(state, makeState(199 - remaining));
+}
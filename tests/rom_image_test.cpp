@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/cartridge.h"
+#include "polarGB/rom_image.h"
+#include "test_rom.h"
+
+
+/**
+ * Writes a 32 KiB ROM without a memory bank controller to the temporary directory. The fill byte
+ * makes the contents of different ROMs differ. Returns the path of the ROM file.
+ */
+static std::string writeFilledRom(const std::string& name, u8 fill)
+{
+    std::vector<u8> rom(0x8000, fill);
+    std::fill(rom.begin() + 0x134, rom.begin() + 0x14e, 0x00);
+    setHeaderChecksum(rom);
+
+    return writeRomFile(name, rom);
+}
+
+
+TEST(RomImageTest, MapsFileContents)
+{
+    std::shared_ptr<const RomImage> image = RomImage::open(writeFilledRom("rom_image", 0x3c));
+
+    ASSERT_EQ(image->size(), 0x8000u);
+    ASSERT_EQ(image->data()[0x0000], 0x3c);
+    ASSERT_EQ(image->data()[0x7fff], 0x3c);
+}
+
+
+TEST(RomImageTest, SameContentsShareImage)
+{
+    std::string fileName = writeFilledRom("rom_image_shared", 0x11);
+    std::string copyName = writeFilledRom("rom_image_shared_copy", 0x11);
+    std::string otherName = writeFilledRom("rom_image_other", 0x22);
+
+    std::shared_ptr<const RomImage> image = RomImage::open(fileName);
+    ASSERT_EQ(RomImage::open(fileName), image);
+    ASSERT_EQ(RomImage::open(copyName), image);
+    ASSERT_NE(RomImage::open(otherName), image);
+    ASSERT_NE(RomImage::open(otherName)->hash(), image->hash());
+}
+
+
+TEST(RomImageTest, MissingFileThrows)
+{
+    ASSERT_THROW(RomImage::open("/nonexistent/rom.gb"), std::runtime_error);
+}
+
+
+TEST(RomImageTest, CartridgesShareRom)
+{
+    std::string fileName = writeFilledRom("rom_image_cartridge", 0x33);
+
+    Cartridge first;
+    Cartridge second;
+    first.load(fileName);
+    second.load(fileName);
+
+    ASSERT_EQ(first.getRomBankData(0x0000), second.getRomBankData(0x0000));
+    ASSERT_EQ(first.getRomBankData(0x4000), second.getRomBankData(0x4000));
+    ASSERT_EQ(first.read(0x4000), 0x33);
+}
@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/cartridge.h"
+#include "polarGB/emulator.h"
+#include "polarGB/rom_image.h"
+#include "polarGB/save_state.h"
+#include "test_rom.h"
+
+
+/* Increments 0xc000 and scrolls the background forever. */
+static const std::vector<u8> COUNTER_PROGRAM = {
+    0x21, 0x00, 0xc0,   /* 0x100: LD HL, 0xc000 */
+    0x34,               /* 0x103: INC (HL) */
+    0x7e,               /* 0x104: LD A, (HL) */
+    0xe0, 0x43,         /* 0x105: LDH (SCX), A */
+    0x18, 0xfa          /* 0x107: JR 0x103 */
+};
+
+
+class SaveStateTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        romPath = writeTestRom("save_state_counter", COUNTER_PROGRAM);
+        emu = createEmulator(romPath);
+    }
+
+    static std::unique_ptr<Emulator> createEmulator(const std::string& path)
+    {
+        EmulatorOptions options;
+        options.headless = true;
+        std::unique_ptr<Emulator> emulator = std::make_unique<Emulator>(options);
+        emulator->loadCartridge(path);
+        return emulator;
+    }
+
+    static std::vector<u8> snapshot(Emulator& emulator)
+    {
+        std::vector<u8> result = {
+            emulator.readMemory(0xc000),
+            emulator.readMemory(0xff43),
+            emulator.readMemory(0xff44),
+            (u8)emulator.readRegister(RegID_PC),
+            (u8)emulator.readRegister(RegID_F)
+        };
+        const u8* framebuffer = emulator.getFramebuffer();
+        result.insert(result.end(), framebuffer, framebuffer + SCREEN_WIDTH * SCREEN_HEIGHT * 4);
+        return result;
+    }
+
+    std::string romPath;
+    std::unique_ptr<Emulator> emu;
+};
+
+
+TEST_F(SaveStateTest, RestoresExecution)
+{
+    emu->runFrames(3);
+    emu->runCycles(1234);
+    std::vector<u8> state = emu->saveState();
+    u64 savedCycles = emu->getCyclesCompleted();
+
+    emu->runFrames(2);
+    std::vector<u8> expected = snapshot(*emu);
+    u64 expectedCycles = emu->getCyclesCompleted();
+
+    emu->loadState(state);
+    ASSERT_EQ(emu->getCyclesCompleted(), savedCycles);
+    ASSERT_EQ(emu->getFramesCompleted(), 3u);
+
+    emu->runFrames(2);
+    ASSERT_EQ(emu->getCyclesCompleted(), expectedCycles);
+    ASSERT_EQ(snapshot(*emu), expected);
+}
+
+
+TEST_F(SaveStateTest, ForksIntoOtherInstances)
+{
+    emu->runFrames(2);
+    std::vector<u8> state = emu->saveState();
+    emu->runFrames(3);
+
+    for(int i = 0; i < 3; i++)
+    {
+        std::unique_ptr<Emulator> fork = createEmulator(romPath);
+        fork->loadState(state);
+        fork->runFrames(3);
+        ASSERT_EQ(fork->getCyclesCompleted(), emu->getCyclesCompleted());
+        ASSERT_EQ(snapshot(*fork), snapshot(*emu));
+    }
+}
+
+
+TEST_F(SaveStateTest, RejectsStateOfOtherRom)
+{
+    std::vector<u8> program = COUNTER_PROGRAM;
+    program.push_back(0x76);
+    std::unique_ptr<Emulator> other = createEmulator(writeTestRom("save_state_other", program));
+    other->runFrames(1);
+
+    emu->runFrames(1);
+    std::vector<u8> before = snapshot(*emu);
+    ASSERT_THROW(emu->loadState(other->saveState()), std::runtime_error);
+
+    /* The emulator is left untouched. */
+    ASSERT_EQ(snapshot(*emu), before);
+    ASSERT_EQ(emu->getFramesCompleted(), 1u);
+}
+
+
+TEST_F(SaveStateTest, RejectsInvalidData)
+{
+    std::vector<u8> state = emu->saveState();
+
+    std::vector<u8> truncated(state.begin(), state.end() - 1);
+    ASSERT_THROW(emu->loadState(truncated), std::runtime_error);
+
+    std::vector<u8> version = state;
+    version[4]++;
+    ASSERT_THROW(emu->loadState(version), std::runtime_error);
+
+    ASSERT_THROW(emu->loadState({}), std::runtime_error);
+}
+
+
+TEST_F(SaveStateTest, RejectsOutOfRangeValues)
+{
+    std::vector<u8> state = emu->saveState();
+
+    /* The CPU state follows the header and the counters. The state ends with the joypad, the
+     * interrupt controller (IF, IE, IME and the delayed enable) and the timer. Before those are
+     * the mode, the mode cycles, the empty object list and the framebuffer of the graphics
+     * controller. */
+    size_t cpuStateOffset = 8 + 3 * 8;
+    size_t imeOffset = state.size() - 1 - 2;
+    size_t modeOffset = state.size() - 1 - 4 - 12 - SCREEN_WIDTH * SCREEN_HEIGHT * 4 - 1 - 8 - 1;
+
+    /* LY is the fifth of the 12 registers before the mode, the mode cycles follow the mode. */
+    size_t lyOffset = modeOffset - 12 + 4;
+    size_t modeCyclesOffset = modeOffset + 1;
+
+    /* The state of the cartridge starts with the hash of the ROM, the RAM enable flag and the 2
+     * mapped ROM banks follow it. */
+    u64 hash = RomImage::open(romPath)->hash();
+    std::vector<u8>::iterator hashPosition = std::search(state.begin(), state.end(),
+        (const u8*)&hash, (const u8*)&hash + sizeof(hash));
+    ASSERT_NE(hashPosition, state.end());
+    size_t romBankOffset = hashPosition - state.begin() + sizeof(hash) + 1;
+
+    std::vector<std::vector<u8>> invalidStates;
+    for(size_t offset : {cpuStateOffset, imeOffset, modeOffset})
+    {
+        invalidStates.push_back(state);
+        invalidStates.back()[offset] = 4;
+    }
+
+    invalidStates.push_back(state);
+    invalidStates.back()[lyOffset] = 250;
+
+    /* Only vertical blanking can be past the last line of the screen. */
+    invalidStates.push_back(state);
+    invalidStates.back()[lyOffset] = 150;
+    invalidStates.back()[modeOffset] = 3;
+
+    invalidStates.push_back(state);
+    invalidStates.back()[modeCyclesOffset + 7] = 0x10;
+
+    for(int bank : {-999, 2})
+    {
+        invalidStates.push_back(state);
+        std::memcpy(&invalidStates.back()[romBankOffset + sizeof(int)], &bank, sizeof(bank));
+    }
+
+    for(const std::vector<u8>& invalid : invalidStates)
+        ASSERT_THROW(emu->loadState(invalid), std::runtime_error);
+
+    emu->loadState(state);
+}
+
+
+TEST(MBCSaveStateTest, RestoresBanksAndRam)
+{
+    Cartridge cartridge;
+    cartridge.load(writeTestRom("save_state_mbc1", {}, 0x03, 0x2, 0x3));
+
+    cartridge.write(0x0000, 0x0a);
+    cartridge.write(0x2000, 0x05);
+    cartridge.write(0x6000, 0x01);
+    cartridge.write(0x4000, 0x02);
+    cartridge.write(0xa010, 0x42);
+
+    std::vector<u8> buffer;
+    StateWriter writer(buffer);
+    cartridge.saveState(writer);
+
+    cartridge.write(0xa010, 0x00);
+    cartridge.write(0x2000, 0x03);
+    cartridge.write(0x4000, 0x00);
+    cartridge.write(0x0000, 0x00);
+
+    StateReader reader(buffer);
+    cartridge.loadState(reader);
+    ASSERT_TRUE(reader.atEnd());
+    ASSERT_EQ(cartridge.read(0x4000), 5);
+    ASSERT_EQ(cartridge.read(0xa010), 0x42);
+    ASSERT_NE(cartridge.getRamPage(0xa000), nullptr);
+
+    /* The bank registers are restored as well. */
+    cartridge.write(0x4000, 0x00);
+    ASSERT_NE(cartridge.read(0xa010), 0x42);
+    cartridge.write(0x4000, 0x02);
+    ASSERT_EQ(cartridge.read(0xa010), 0x42);
+}
@@ -0,0 +1,77 @@
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/scanline.h"
+
+
+TEST(ScanlineTest, LinePaletteFollowsRegisters)
+{
+    linePalette_t palette = makeLinePalette(0xe4, 0x1b, 0x00);
+
+    for(int shade = 0; shade < 4; shade++)
+    {
+        ASSERT_EQ(palette[PALETTE_BGP + shade], 0xff - 85 * shade);
+        ASSERT_EQ(palette[PALETTE_OBP0 + shade], 0xff - 85 * (3 - shade));
+        ASSERT_EQ(palette[PALETTE_OBP1 + shade], 0xff);
+    }
+}
+
+
+/**
+ * Compares an expansion with the scalar expansion on random pixels of all 3 palettes.
+ */
+static void expectMatchesScalar(expandFunction_t expand)
+{
+    linePalette_t palette = makeLinePalette(0x93, 0xd2, 0x4e);
+
+    /* Odd lengths cover the scalar tails of the vector loops. */
+    for(size_t count : {160, 37, 15, 1})
+    {
+        std::vector<u8> pixels(count);
+        for(u8& pixel : pixels)
+            pixel = rand() % 12;
+
+        std::vector<u8> expected(count * 4);
+        std::vector<u8> output(count * 4);
+        expandScanlineScalar(pixels.data(), palette, expected.data(), count);
+        expand(pixels.data(), palette, output.data(), count);
+        ASSERT_EQ(output, expected);
+    }
+}
+
+
+#ifdef SCANLINE_X86
+TEST(ScanlineTest, Sse2MatchesScalar)
+{
+    if(!__builtin_cpu_supports("sse2"))
+        GTEST_SKIP() << "The processor does not support SSE2";
+
+    expectMatchesScalar(expandScanlineSse2);
+}
+
+
+TEST(ScanlineTest, Avx2MatchesScalar)
+{
+    if(!__builtin_cpu_supports("avx2"))
+        GTEST_SKIP() << "The processor does not support AVX2";
+
+    expectMatchesScalar(expandScanlineAvx2);
+}
+#endif
+
+
+TEST(ScanlineTest, ExpandMatchesScalar)
+{
+    expectMatchesScalar(expandScanline);
+
+    /* Pixel layout, r, g, b and a. */
+    linePalette_t palette = makeLinePalette(0x93, 0xd2, 0x4e);
+    u8 pixel = PALETTE_OBP1 | 3;
+    u8 output[4];
+    expandScanline(&pixel, palette, output, 1);
+    ASSERT_EQ(output[0], 0xaa);
+    ASSERT_EQ(output[1], 0xaa);
+    ASSERT_EQ(output[2], 0xaa);
+    ASSERT_EQ(output[3], 0xff);
+}
@@ -0,0 +1,68 @@
+#ifndef TEST_ROM_H
+#define TEST_ROM_H
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "polarGB/types.h"
+#include "polarGB/mbc.h"
+
+
+/* Header checksum over the title and cartridge info. */
+inline void setHeaderChecksum(std::vector<u8>& rom)
+{
+    u8 checksum = 0;
+    for(u16 addr = 0x134; addr <= 0x14c; addr++)
+        checksum = checksum - rom[addr] - 1;
+    rom[0x14d] = checksum;
+}
+
+
+/**
+ * Writes a ROM image to the temporary directory and returns the path of the ROM file. The file is
+ * written next to its path and then renamed over it, so a ROM that is still mapped by an earlier
+ * test keeps its old contents instead of being truncated under it.
+ */
+inline std::string writeRomFile(const std::string& name, const std::vector<u8>& rom)
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / (name + ".gb");
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+
+    {
+        std::ofstream f(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        f.write((const char *)rom.data(), rom.size());
+    }
+    std::filesystem::rename(tempPath, path);
+
+    return path.string();
+}
+
+
+/**
+ * Writes a ROM with the given cartridge info to the temporary directory. Every ROM bank starts
+ * with its bank number, low byte first, and the program is placed at the entry point 0x100.
+ * Returns the path of the ROM file.
+ */
+inline std::string writeTestRom(const std::string& name, const std::vector<u8>& program,
+    u8 cartridgeType = 0x00, u8 romSizeCode = 0x0, u8 ramSizeCode = 0x0)
+{
+    std::vector<u8> rom(0x8000 << romSizeCode, 0x00);
+    for(size_t bank = 0; bank < rom.size() / ROM_BANK_SIZE; bank++)
+    {
+        rom[bank * ROM_BANK_SIZE] = bank & 0xff;
+        rom[bank * ROM_BANK_SIZE + 1] = bank >> 8;
+    }
+    std::copy(program.begin(), program.end(), rom.begin() + 0x100);
+
+    rom[0x147] = cartridgeType;
+    rom[0x148] = romSizeCode;
+    rom[0x149] = ramSizeCode;
+    setHeaderChecksum(rom);
+
+    return writeRomFile(name, rom);
+}
+
+#endif /* TEST_ROM_H */
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <thread>
+#include <gtest/gtest.h>
+#include "polarGB/types.h"
+#include "polarGB/triple_buffer.h"
+
+
+const size_t FRAME_SIZE = 64;
+
+
+TEST(TripleBufferTest, ConsumesNewestFrame)
+{
+    TripleBuffer buffer(FRAME_SIZE);
+    ASSERT_FALSE(buffer.consume());
+
+    buffer.getWriteBuffer()[0] = 1;
+    buffer.publish();
+    ASSERT_TRUE(buffer.hasNewFrame());
+    ASSERT_TRUE(buffer.consume());
+    ASSERT_EQ(buffer.getReadBuffer()[0], 1);
+    ASSERT_FALSE(buffer.consume());
+    ASSERT_EQ(buffer.getReadBuffer()[0], 1);
+
+    /* The second frame replaces the third before it is consumed. */
+    buffer.getWriteBuffer()[0] = 2;
+    buffer.publish();
+    buffer.getWriteBuffer()[0] = 3;
+    buffer.publish();
+    ASSERT_TRUE(buffer.consume());
+    ASSERT_EQ(buffer.getReadBuffer()[0], 3);
+
+    ASSERT_EQ(buffer.getPublishedFrames(), 3);
+    ASSERT_EQ(buffer.getDroppedFrames(), 1);
+}
+
+
+TEST(TripleBufferTest, ConcurrentFramesAreComplete)
+{
+    const u32 frameCount = 20000;
+    TripleBuffer buffer(FRAME_SIZE);
+
+    std::thread producer([&buffer]()
+    {
+        for(u32 frame = 1; frame <= frameCount; frame++)
+        {
+            std::fill_n(buffer.getWriteBuffer(), FRAME_SIZE, frame & 0xff);
+            buffer.getWriteBuffer()[0] = frame >> 8;
+            buffer.publish();
+        }
+    });
+
+    /* Every frame is taken whole and they arrive in order. */
+    u32 consumed = 0;
+    u32 lastFrame = 0;
+    while(lastFrame < frameCount)
+    {
+        if(!buffer.consume())
+            continue;
+
+        const u8* frame = buffer.getReadBuffer();
+        for(size_t i = 2; i < FRAME_SIZE; i++)
+            ASSERT_EQ(frame[i], frame[1]);
+
+        u32 number = frame[0] << 8 | frame[1];
+        ASSERT_GT(number, lastFrame);
+        lastFrame = number;
+        consumed++;
+    }
+    producer.join();
+
+    ASSERT_EQ(buffer.getPublishedFrames(), frameCount);
+    ASSERT_EQ(consumed + buffer.getDroppedFrames(), frameCount);
+}